@@ -19,41 +19,121 @@ TEMPLATE = app
 #DEFINES += DEPLOY # Pour une compilation dans un but de déploiement
 
 SOURCES += main.cpp\
+    animationclip.cpp \
+    animationclock.cpp \
+    assetcache.cpp \
+    assetpack.cpp \
+    assetpreloader.cpp \
+    assetregistry.cpp \
+    bulletbenchmark.cpp \
+    bulletengine.cpp \
+    bulletpatterns.cpp \
+    collisionbenchmark.cpp \
     Decor.cpp \
+    enemybenchmark.cpp \
+    enemystore.cpp \
     EnnemiLeever.cpp \
     EnnemiLeeverRouge.cpp \
     ennemifactory.cpp \
     ennemioctopus.cpp \
     ennemy.cpp \
+    fontregistry.cpp \
+    gameclips.cpp \
+    gamepools.cpp \
+    gamerandom.cpp \
+    headlessrunner.cpp \
+    inputrecording.cpp \
+    itemdroptickhandler.cpp \
     mainfrm.cpp \
     gamescene.cpp \
     player.cpp \
     projectile.cpp \
+    projectilebenchmark.cpp \
+    projectilebuffer.cpp \
+    randomstream.cpp \
+    spatialhashgrid.cpp \
     sprite.cpp \
+    startupbenchmark.cpp \
+    startuptimer.cpp \
+    statictextitem.cpp \
     gamecore.cpp \
     resources.cpp \
     gameview.cpp \
     utilities.cpp \
     gamecanvas.cpp \
-    spritetickhandler.cpp
+    spritetickhandler.cpp \
+    scaledframecache.cpp \
+    textureatlas.cpp \
+    thinkscheduler.cpp \
+    tickprofiler.cpp \
+    timerwheel.cpp \
+    tracerecorder.cpp \
+    workerpool.cpp
 
 HEADERS  += mainfrm.h \
+    animationclip.h \
+    animationclock.h \
+    assetcache.h \
+    assetpack.h \
+    assetpreloader.h \
+    assetregistry.h \
+    bulletbenchmark.h \
+    bulletengine.h \
+    bulletpatterns.h \
+    collisionbenchmark.h \
     Decor.h \
+    enemybenchmark.h \
+    enemystore.h \
     EnnemiLeever.h \
     EnnemiLeeverRouge.h \
     ennemifactory.h \
     ennemioctopus.h \
     ennemy.h \
+    fontregistry.h \
+    gameclips.h \
+    gamepools.h \
+    gamerandom.h \
+    headlessrunner.h \
+    inputrecording.h \
+    itemdroptickhandler.h \
+    objectpool.h \
     gamescene.h \
     player.h \
     projectile.h \
+    projectilebenchmark.h \
+    projectilebuffer.h \
+    randomstream.h \
+    spatialhashgrid.h \
     sprite.h \
+    startupbenchmark.h \
+    startuptimer.h \
+    statictextitem.h \
     gamecore.h \
     resources.h \
     gameview.h \
     utilities.h \
     gamecanvas.h \
-    spritetickhandler.h
+    spritetickhandler.h \
+    scaledframecache.h \
+    textureatlas.h \
+    thinkscheduler.h \
+    tickprofiler.h \
+    timerwheel.h \
+    tracerecorder.h \
+    workerpool.h
 
 FORMS    += mainfrm.ui
 
+# Cible « make assetpack » : construit le paquet des images décodées (res/assets.pack),
+# chargé au démarrage à la place des fichiers d'images (voir AssetPack).
+unix: assetpack.commands = ./$(TARGET) --build-asset-pack $$shell_quote($$clean_path($$PWD/../res/assets.pack))
+win32: assetpack.commands = $(DESTDIR_TARGET) --build-asset-pack $$shell_quote($$shell_path($$clean_path($$PWD/../res/assets.pack)))
+assetpack.depends = first
+QMAKE_EXTRA_TARGETS += assetpack
+
+# Cible « make benchstartup » : lance le jeu plusieurs fois sans affichage et mesure
+# le temps jusqu'à la première image (voir StartupBenchmark).
+unix: benchstartup.commands = ./$(TARGET) --bench-startup 10
+win32: benchstartup.commands = $(DESTDIR_TARGET) --bench-startup 10
+benchstartup.depends = first
+QMAKE_EXTRA_TARGETS += benchstartup
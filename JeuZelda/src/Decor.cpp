@@ -4,11 +4,10 @@
 #include "gamecore.h"
 #include "gamescene.h"
 
-Decor::Decor(QString imagePath, int posX, int posY) : Sprite(imagePath)
+Decor::Decor(AssetRegistry::AssetId assetId, int posX, int posY) : Sprite(assetId)
 {
     // Création du sprite "Decor" (arbre, rocher, ect...).
-    new Sprite(GameFramework::imagesPath() + imagePath);
     setPos(posX, posY);
     setScale(GameCore::DECOR_SCALE_FACTOR);
-    setData(GameCore::SPRITE_TYPE_KEY, GameCore::SpriteType::DECOR);
+    setSpriteType(GameCore::SpriteType::DECOR);
 }
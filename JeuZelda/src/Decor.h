@@ -6,7 +6,7 @@
 class Decor : public Sprite
 {
 public:
-    Decor(QString imagePath, int posX, int posY);
+    Decor(AssetRegistry::AssetId assetId, int posX, int posY);
 };
 
 #endif // DECOR_H
@@ -11,16 +11,17 @@ class EnnemiLeever : public Ennemy
 public:
     EnnemiLeever();
     ~EnnemiLeever() override;
-    void tick(long long elapsedTimeInMilliseconds) override;
     void damage();
+    void reset() override;
+
+protected:
+    void releaseToPool() override;
 
 private:
     static constexpr float LEEVER_SCALE_FACTOR = 4;
-    static constexpr int LEEVER_RANGE = 80;
     static constexpr int CHANCE_TO_SPAWN_HEART = 9;
     static constexpr int CHANCE_TO_SPAWN_BLUE_RING = 18;
     static constexpr int CHANCE_TO_SPAWN_TRIFORCE = 50;
-    int m_Hp = 1;
 };
 
 
@@ -0,0 +1,58 @@
+/**
+  \file
+  \brief    Définition de la classe AnimationClip.
+  \date     octobre 2026
+*/
+#include "animationclip.h"
+
+QHash<QString, AnimationClipPointer> AnimationClip::s_registeredClips;
+
+//! Construit une animation.
+//! \param rFrames        Images de l'animation, dans l'ordre d'affichage.
+//! \param frameDuration  Durée d'une image en millisecondes (0 : durée choisie par le sprite).
+//! \param loopMode       Comportement à la fin de la suite d'images.
+AnimationClip::AnimationClip(const QVector<SpriteFrame>& rFrames, int frameDuration, LoopMode loopMode) {
+    m_frames = rFrames;
+    m_frameDuration = frameDuration;
+    m_loopMode = loopMode;
+}
+
+//! \return une nouvelle animation, non enregistrée (voir le constructeur).
+AnimationClipPointer AnimationClip::create(const QVector<SpriteFrame>& rFrames, int frameDuration, LoopMode loopMode) {
+    return AnimationClipPointer(new AnimationClip(rFrames, frameDuration, loopMode));
+}
+
+//! Enregistre une animation sous le nom donné.
+//! Les images sont obtenues depuis l'atlas de textures (TextureAtlas::frame()).
+//! Si une animation porte déjà ce nom, c'est elle qui est retournée, inchangée.
+//! \param rName          Nom de l'animation.
+//! \param rImagePaths    Chemins des images de l'animation, dans l'ordre d'affichage.
+//! \param frameDuration  Durée d'une image en millisecondes (0 : durée choisie par le sprite).
+//! \param loopMode       Comportement à la fin de la suite d'images.
+//! \return l'animation enregistrée sous ce nom.
+AnimationClipPointer AnimationClip::registerClip(const QString& rName, const QStringList& rImagePaths,
+                                                 int frameDuration, LoopMode loopMode) {
+    auto it = s_registeredClips.constFind(rName);
+    if (it != s_registeredClips.constEnd())
+        return it.value();
+
+    QVector<SpriteFrame> frames;
+    frames.reserve(rImagePaths.count());
+    for (const QString& rImagePath : rImagePaths)
+        frames << TextureAtlas::frame(rImagePath);
+
+    AnimationClipPointer pClip = create(frames, frameDuration, loopMode);
+    s_registeredClips.insert(rName, pClip);
+    return pClip;
+}
+
+//! \return l'animation enregistrée sous le nom donné, ou un pointeur nul s'il n'y en a pas.
+AnimationClipPointer AnimationClip::clip(const QString& rName) {
+    return s_registeredClips.value(rName);
+}
+
+//! Oublie les animations enregistrées.
+//! Les animations encore affichées par des sprites ne sont détruites qu'avec eux.
+void AnimationClip::clearRegistry() {
+    s_registeredClips.clear();
+}
@@ -0,0 +1,68 @@
+/**
+  \file
+  \brief    Déclaration de la classe AnimationClip.
+  \date     octobre 2026
+*/
+#ifndef ANIMATIONCLIP_H
+#define ANIMATIONCLIP_H
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "textureatlas.h"
+
+class AnimationClip;
+
+//! Pointeur partagé sur une animation : l'animation est détruite avec le dernier pointeur.
+typedef QSharedPointer<const AnimationClip> AnimationClipPointer;
+
+//! \brief Animation immuable : une suite d'images, la durée de chaque image et le
+//! comportement à la fin de la suite.
+//!
+//! Une animation ne change plus une fois construite : elle peut donc être partagée par
+//! tous les sprites qui l'affichent (Sprite::setAnimationClip()). Chaque sprite ne
+//! conserve que le pointeur sur son animation, l'image affichée et le temps écoulé,
+//! ce qui rend la création d'un sprite animé peu coûteuse.
+//!
+//! Les animations utilisées en de nombreux exemplaires sont enregistrées une seule fois,
+//! sous un nom, avec registerClip(), puis retrouvées avec clip() (voir GameClips).
+//!
+//! Comme les images peuvent être des QPixmap, les animations ne doivent être utilisées
+//! que depuis le thread de l'interface graphique, et clearRegistry() doit être appelé
+//! avant la destruction de QApplication.
+class AnimationClip
+{
+public:
+    enum LoopMode {
+        LOOP,   //!< L'animation reprend à la première image.
+        ONCE    //!< L'animation s'arrête sur la dernière image.
+    };
+
+    AnimationClip(const QVector<SpriteFrame>& rFrames, int frameDuration = 0, LoopMode loopMode = LOOP);
+
+    bool isEmpty() const { return m_frames.isEmpty(); }
+    int frameCount() const { return static_cast<int>(m_frames.count()); }
+    const SpriteFrame& frame(int frameIndex) const { return m_frames.at(frameIndex); }
+    const QVector<SpriteFrame>& frames() const { return m_frames; }
+    int frameDuration() const { return m_frameDuration; }
+    LoopMode loopMode() const { return m_loopMode; }
+
+    static AnimationClipPointer create(const QVector<SpriteFrame>& rFrames, int frameDuration = 0,
+                                       LoopMode loopMode = LOOP);
+    static AnimationClipPointer registerClip(const QString& rName, const QStringList& rImagePaths,
+                                             int frameDuration, LoopMode loopMode = LOOP);
+    static AnimationClipPointer clip(const QString& rName);
+    static void clearRegistry();
+
+private:
+    QVector<SpriteFrame> m_frames;
+    int m_frameDuration;
+    LoopMode m_loopMode;
+
+    static QHash<QString, AnimationClipPointer> s_registeredClips;
+};
+
+#endif // ANIMATIONCLIP_H
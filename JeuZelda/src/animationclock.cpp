@@ -0,0 +1,129 @@
+/**
+  \file
+  \brief    Définition de la classe AnimationClock.
+  \date     octobre 2026
+*/
+#include "animationclock.h"
+
+#include "sprite.h"
+
+const int NO_SLOT = -1;
+
+//! Construit une horloge d'animation, sans aucun sprite inscrit.
+AnimationClock::AnimationClock() {
+    m_isAdvancing = false;
+    m_hasVacantSlots = false;
+    m_timeScale = 1.0;
+    m_pendingTime = 0.0;
+}
+
+//! Inscrit le sprite donné auprès de cette horloge.
+//! Si le sprite est déjà inscrit, cette fonction ne fait rien.
+//! \param pSprite  Sprite dont l'animation doit être cadencée par cette horloge.
+void AnimationClock::registerSprite(Sprite* pSprite) {
+    Q_ASSERT(pSprite != nullptr);
+
+    if (pSprite->m_pAnimationClock == this)
+        return;
+
+    Q_ASSERT(pSprite->m_pAnimationClock == nullptr);
+
+    pSprite->m_pAnimationClock = this;
+    pSprite->m_animationClockSlot = m_sprites.count();
+    m_sprites.append(pSprite);
+}
+
+//! Désinscrit le sprite donné de cette horloge.
+//! Si le sprite n'est pas inscrit, cette fonction ne fait rien.
+//! Pendant advance(), l'emplacement du sprite est simplement libéré : le
+//! tableau est compacté à la fin du passage.
+//! \param pSprite  Sprite à désinscrire.
+void AnimationClock::unregisterSprite(Sprite* pSprite) {
+    if (pSprite == nullptr || pSprite->m_pAnimationClock != this)
+        return;
+
+    int slot = pSprite->m_animationClockSlot;
+    Q_ASSERT(slot >= 0 && slot < m_sprites.count() && m_sprites[slot] == pSprite);
+
+    if (m_isAdvancing) {
+        m_sprites[slot] = nullptr;
+        m_hasVacantSlots = true;
+    } else {
+        // Le dernier sprite prend la place de celui qui est retiré.
+        Sprite* pLastSprite = m_sprites.last();
+        m_sprites[slot] = pLastSprite;
+        pLastSprite->m_animationClockSlot = slot;
+        m_sprites.removeLast();
+    }
+
+    pSprite->m_pAnimationClock = nullptr;
+    pSprite->m_animationClockSlot = NO_SLOT;
+}
+
+//! \return un booléen qui indique si le sprite donné est inscrit auprès de cette horloge.
+bool AnimationClock::isRegistered(const Sprite* pSprite) const {
+    return pSprite != nullptr && pSprite->m_pAnimationClock == this;
+}
+
+//! \return le nombre d'animations actuellement cadencées par cette horloge.
+int AnimationClock::runningAnimationCount() const {
+    return m_hasVacantSlots ? static_cast<int>(m_sprites.count() - m_sprites.count(nullptr))
+                            : static_cast<int>(m_sprites.count());
+}
+
+//! Change le facteur d'échelle du temps des animations.
+//! Avec un facteur de 2, les animations vont deux fois plus vite, avec un facteur
+//! de 0.5, deux fois moins vite. Un facteur de 0 fige les animations.
+//! \param timeScale  Facteur d'échelle du temps (doit être positif ou nul).
+void AnimationClock::setTimeScale(double timeScale) {
+    m_timeScale = qMax(0.0, timeScale);
+}
+
+//! \return le facteur d'échelle du temps des animations.
+double AnimationClock::timeScale() const {
+    return m_timeScale;
+}
+
+//! Fait avancer toutes les animations inscrites du temps donné.
+//! Les fractions de millisecondes dues au facteur d'échelle sont conservées
+//! pour le prochain appel, afin de ne pas dériver.
+//! \param elapsedTimeInMilliseconds  Temps écoulé depuis l'appel précédent.
+void AnimationClock::advance(long long elapsedTimeInMilliseconds) {
+    m_pendingTime += elapsedTimeInMilliseconds * m_timeScale;
+    long long step = static_cast<long long>(m_pendingTime);
+    if (step <= 0)
+        return;
+    m_pendingTime -= step;
+
+    m_isAdvancing = true;
+
+    // Les sprites inscrits pendant ce passage (par exemple suite à l'émission de
+    // animationFinished()) ne seront animés qu'à partir du prochain tick.
+    const int spriteCount = m_sprites.count();
+    for (int slot = 0; slot < spriteCount; ++slot) {
+        Sprite* pSprite = m_sprites[slot];
+        if (pSprite != nullptr)
+            pSprite->advanceAnimation(step);
+    }
+
+    m_isAdvancing = false;
+
+    if (m_hasVacantSlots)
+        compact();
+}
+
+//! Supprime les emplacements libérés pendant advance() en préservant l'ordre
+//! des sprites restants.
+void AnimationClock::compact() {
+    int writeSlot = 0;
+    for (int readSlot = 0; readSlot < m_sprites.count(); ++readSlot) {
+        Sprite* pSprite = m_sprites[readSlot];
+        if (pSprite == nullptr)
+            continue;
+        m_sprites[writeSlot] = pSprite;
+        pSprite->m_animationClockSlot = writeSlot;
+        ++writeSlot;
+    }
+    m_sprites.resize(writeSlot);
+    m_hasVacantSlots = false;
+}
@@ -0,0 +1,57 @@
+/**
+  \file
+  \brief    Déclaration de la classe AnimationClock.
+  \date     octobre 2026
+*/
+#ifndef ANIMATIONCLOCK_H
+#define ANIMATIONCLOCK_H
+
+#include <QVector>
+
+class Sprite;
+
+//! \brief Horloge qui fait avancer les animations des sprites d'une scène.
+//!
+//! Chaque scène (GameScene) possède sa propre horloge d'animation, qu'elle fait
+//! avancer lors de chaque tick (GameScene::tick()) avec le temps écoulé depuis le
+//! tick précédent.
+//!
+//! Les sprites dont l'animation est démarrée (Sprite::startAnimation()) s'inscrivent
+//! automatiquement auprès de l'horloge de leur scène et s'en désinscrivent lorsque
+//! leur animation est stoppée, lorsqu'ils sont retirés de la scène ou lorsqu'ils
+//! sont détruits.
+//!
+//! Les sprites inscrits sont conservés dans un tableau compact, parcouru une seule
+//! fois par tick par advance().
+//!
+//! Comme l'horloge est cadencée par le tick du jeu, les animations sont
+//! automatiquement suspendues lorsque la cadence est stoppée (GameCanvas::stopTick())
+//! et leur vitesse ne dépend pas de la fréquence des ticks.
+//! Il est également possible d'accélérer ou de ralentir toutes les animations de
+//! la scène avec setTimeScale().
+class AnimationClock
+{
+public:
+    AnimationClock();
+
+    void registerSprite(Sprite* pSprite);
+    void unregisterSprite(Sprite* pSprite);
+    bool isRegistered(const Sprite* pSprite) const;
+    int runningAnimationCount() const;
+
+    void setTimeScale(double timeScale);
+    double timeScale() const;
+
+    void advance(long long elapsedTimeInMilliseconds);
+
+private:
+    void compact();
+
+    QVector<Sprite*> m_sprites;
+    bool m_isAdvancing;
+    bool m_hasVacantSlots;
+    double m_timeScale;
+    double m_pendingTime;
+};
+
+#endif // ANIMATIONCLOCK_H
@@ -0,0 +1,94 @@
+/**
+  \file
+  \brief    Définition de la classe AssetCache.
+  \date     octobre 2026
+*/
+#include "assetcache.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QMutexLocker>
+
+QMutex AssetCache::s_mutex;
+QHash<QString, QPixmap> AssetCache::s_pixmaps;
+QAtomicInt AssetCache::s_hitCount;
+QAtomicInt AssetCache::s_missCount;
+
+//! Retourne l'image correspondant au chemin donné.
+//! Si l'image n'a encore jamais été demandée, elle est décodée depuis le disque
+//! et mémorisée. Sinon, c'est l'image mémorisée qui est retournée.
+//! Doit être appelé depuis le thread de l'interface graphique.
+//! \param rImagePath  Chemin de l'image.
+//! \return l'image, ou une image nulle si le fichier ne peut pas être lu.
+QPixmap AssetCache::pixmap(const QString& rImagePath) {
+    const QString key = cacheKey(rImagePath);
+
+    {
+        QMutexLocker locker(&s_mutex);
+        auto it = s_pixmaps.constFind(key);
+        if (it != s_pixmaps.constEnd()) {
+            s_hitCount.ref();
+            return it.value();
+        }
+    }
+
+    // Le décodage est fait hors du verrou, afin de ne pas bloquer les autres
+    // threads qui consultent le cache pendant ce temps.
+    s_missCount.ref();
+    QPixmap decodedPixmap(key);
+    if (decodedPixmap.isNull())
+        qWarning() << "Image introuvable :" << key;
+
+    QMutexLocker locker(&s_mutex);
+    // Si l'image a été ajoutée entre-temps (par exemple par insert()), c'est
+    // celle-ci qui est conservée.
+    auto it = s_pixmaps.constFind(key);
+    if (it != s_pixmaps.constEnd())
+        return it.value();
+
+    s_pixmaps.insert(key, decodedPixmap);
+    return decodedPixmap;
+}
+
+//! Ajoute au cache une image déjà décodée.
+//! Si une image est déjà mémorisée pour ce chemin, elle est remplacée.
+//! \param rImagePath  Chemin de l'image.
+//! \param rPixmap     Image décodée.
+void AssetCache::insert(const QString& rImagePath, const QPixmap& rPixmap) {
+    const QString key = cacheKey(rImagePath);
+    QMutexLocker locker(&s_mutex);
+    s_pixmaps.insert(key, rPixmap);
+}
+
+//! \return un booléen qui indique si l'image donnée se trouve déjà dans le cache.
+bool AssetCache::contains(const QString& rImagePath) {
+    const QString key = cacheKey(rImagePath);
+    QMutexLocker locker(&s_mutex);
+    return s_pixmaps.contains(key);
+}
+
+//! Vide le cache et remet à zéro les compteurs.
+//! Cette fonction doit être appelée avant la destruction de l'application,
+//! afin que les images ne soient pas détruites après QApplication.
+void AssetCache::clear() {
+    QMutexLocker locker(&s_mutex);
+    s_pixmaps.clear();
+    s_hitCount.storeRelaxed(0);
+    s_missCount.storeRelaxed(0);
+}
+
+//! \return le nombre de demandes satisfaites par une image déjà décodée.
+int AssetCache::hitCount() {
+    return s_hitCount.loadRelaxed();
+}
+
+//! \return le nombre de demandes qui ont nécessité un décodage depuis le disque.
+int AssetCache::missCount() {
+    return s_missCount.loadRelaxed();
+}
+
+//! Normalise le chemin donné afin de l'utiliser comme clé.
+//! Aucun accès au disque n'est fait.
+QString AssetCache::cacheKey(const QString& rImagePath) {
+    return QDir::cleanPath(QDir::fromNativeSeparators(rImagePath));
+}
@@ -0,0 +1,58 @@
+/**
+  \file
+  \brief    Déclaration de la classe AssetCache.
+  \date     octobre 2026
+*/
+#ifndef ASSETCACHE_H
+#define ASSETCACHE_H
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QMutex>
+#include <QPixmap>
+#include <QString>
+
+//! \brief Cache des images décodées, partagé par toute l'application.
+//!
+//! Chaque image n'est décodée depuis le disque qu'une seule fois par processus :
+//! les appels suivants à pixmap() avec le même chemin retournent une copie
+//! implicitement partagée (QPixmap) de l'image déjà décodée, ce qui ne coûte
+//! qu'une incrémentation de compteur de références.
+//!
+//! Le chemin donné est normalisé (séparateurs, `.` et `..`) avant d'être utilisé
+//! comme clé, afin que deux écritures différentes d'un même chemin partagent
+//! la même entrée.
+//!
+//! Les images introuvables sont également mémorisées (image nulle), afin de ne
+//! pas retenter de les lire à chaque appel.
+//!
+//! L'accès à la table est protégé par un mutex : il est possible d'ajouter des
+//! images depuis plusieurs threads avec insert(). Toutefois, comme un QPixmap
+//! ne peut être créé que dans le thread de l'interface graphique, pixmap()
+//! ne doit être appelé que depuis ce thread.
+//!
+//! Les méthodes hitCount() et missCount() permettent de connaître l'efficacité
+//! du cache.
+class AssetCache
+{
+public:
+    static QPixmap pixmap(const QString& rImagePath);
+    static void insert(const QString& rImagePath, const QPixmap& rPixmap);
+    static bool contains(const QString& rImagePath);
+    static void clear();
+
+    static int hitCount();
+    static int missCount();
+
+private:
+    AssetCache() = delete;
+
+    static QString cacheKey(const QString& rImagePath);
+
+    static QMutex s_mutex;
+    static QHash<QString, QPixmap> s_pixmaps;
+    static QAtomicInt s_hitCount;
+    static QAtomicInt s_missCount;
+};
+
+#endif // ASSETCACHE_H
@@ -0,0 +1,188 @@
+/**
+  \file
+  \brief    Définition de la classe AssetPack.
+  \date     octobre 2026
+*/
+#include "assetpack.h"
+
+#include <cstring>
+
+#include <QDebug>
+#include <QDir>
+#include <QSaveFile>
+#include <QVector>
+
+#include "resources.h"
+
+//! Signature placée au début du paquet.
+static const char PACK_MAGIC[4] = { 'Z', 'F', 'A', 'P' };
+
+//! Valeur écrite dans l'en-tête, qui permet de reconnaître un paquet construit sur une
+//! machine dont l'ordre des octets est différent.
+static const quint32 BYTE_ORDER_MARK = 0x01020304;
+
+QFile AssetPack::s_file;
+const uchar* AssetPack::s_pData = nullptr;
+
+//! \return le chemin du paquet chargé au démarrage : `res/assets.pack`.
+QString AssetPack::defaultPath() {
+    return GameFramework::resourcesPath() + "assets.pack";
+}
+
+//! Construit le paquet : chaque image du registre est décodée depuis son fichier et
+//! convertie au format ARGB32 prémultiplié. Une image illisible est inscrite vide dans
+//! l'index ; elle sera chargée depuis son fichier à l'exécution.
+//! \param rPackPath  Chemin du paquet à écrire (un fichier existant est remplacé).
+//! \return un booléen à faux si le paquet ne peut pas être écrit.
+bool AssetPack::build(const QString& rPackPath) {
+    QVector<QImage> images;
+    QVector<IndexEntry> index;
+    images.reserve(AssetRegistry::ASSET_COUNT);
+    index.reserve(AssetRegistry::ASSET_COUNT);
+
+    quint64 dataOffset = sizeof(Header) + AssetRegistry::ASSET_COUNT * sizeof(IndexEntry);
+    for (int id = 0; id < AssetRegistry::ASSET_COUNT; id++) {
+        const AssetRegistry::AssetId assetId = static_cast<AssetRegistry::AssetId>(id);
+        QImage image(AssetRegistry::path(assetId));
+        if (image.isNull())
+            qWarning() << "Image illisible, absente du paquet :" << AssetRegistry::path(assetId);
+        else
+            image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+        dataOffset = (dataOffset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+        IndexEntry entry;
+        entry.pathHash = pathHash(AssetRegistry::FILE_NAMES[id]);
+        entry.width = static_cast<quint32>(image.width());
+        entry.height = static_cast<quint32>(image.height());
+        entry.bytesPerLine = static_cast<quint32>(image.bytesPerLine());
+        entry.dataOffset = dataOffset;
+        dataOffset += static_cast<quint64>(image.sizeInBytes());
+
+        images << image;
+        index << entry;
+    }
+
+    QSaveFile file(rPackPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Impossible de créer le paquet d'images :" << rPackPath;
+        return false;
+    }
+
+    Header header;
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.assetCount = AssetRegistry::ASSET_COUNT;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(index.constData()), index.count() * sizeof(IndexEntry));
+
+    for (int id = 0; id < AssetRegistry::ASSET_COUNT; id++) {
+        const QImage& rImage = images.at(id);
+        if (rImage.isNull())
+            continue;
+        const QByteArray padding(static_cast<int>(index.at(id).dataOffset - file.pos()), '\0');
+        file.write(padding);
+        file.write(reinterpret_cast<const char*>(rImage.constBits()), rImage.sizeInBytes());
+    }
+
+    if (!file.commit()) {
+        qWarning() << "Impossible d'écrire le paquet d'images :" << rPackPath;
+        return false;
+    }
+    qInfo().noquote() << QString("Paquet d'images : %1 images, %2 Ko écrits dans %3")
+                         .arg(AssetRegistry::ASSET_COUNT).arg(dataOffset / 1024).arg(rPackPath);
+    return true;
+}
+
+//! Projette en mémoire le paquet donné. Un paquet déjà ouvert est d'abord fermé.
+//! Le paquet est refusé s'il est tronqué, d'une autre version, construit sur une machine
+//! dont l'ordre des octets est différent ou avec un autre registre d'images.
+//! \param rPackPath  Chemin du paquet.
+//! \return un booléen à faux si le paquet est absent ou refusé : les images seront
+//! alors chargées depuis leurs fichiers.
+bool AssetPack::open(const QString& rPackPath) {
+    close();
+
+    s_file.setFileName(rPackPath);
+    if (!s_file.exists())
+        return false;
+    const qint64 fileSize = s_file.size();
+    const qint64 indexEnd = sizeof(Header) + AssetRegistry::ASSET_COUNT * sizeof(IndexEntry);
+    if (!s_file.open(QIODevice::ReadOnly) || fileSize < indexEnd) {
+        qWarning() << "Paquet d'images illisible, ignoré :" << rPackPath;
+        s_file.close();
+        return false;
+    }
+
+    const uchar* pData = s_file.map(0, fileSize);
+    if (pData == nullptr) {
+        qWarning() << "Impossible de projeter le paquet d'images en mémoire :" << rPackPath;
+        s_file.close();
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, pData, sizeof(header));
+    bool isValid = std::memcmp(header.magic, PACK_MAGIC, sizeof(header.magic)) == 0
+                   && header.version == VERSION && header.byteOrderMark == BYTE_ORDER_MARK
+                   && header.assetCount == static_cast<quint32>(AssetRegistry::ASSET_COUNT);
+
+    const IndexEntry* pIndex = reinterpret_cast<const IndexEntry*>(pData + sizeof(Header));
+    for (int id = 0; isValid && id < AssetRegistry::ASSET_COUNT; id++) {
+        const IndexEntry& rEntry = pIndex[id];
+        isValid = rEntry.pathHash == pathHash(AssetRegistry::FILE_NAMES[id])
+                  && rEntry.dataOffset % DATA_ALIGNMENT == 0
+                  && rEntry.dataOffset + quint64(rEntry.bytesPerLine) * rEntry.height <= quint64(fileSize);
+    }
+    if (!isValid) {
+        qWarning() << "Paquet d'images périmé ou invalide, ignoré :" << rPackPath;
+        s_file.unmap(const_cast<uchar*>(pData));
+        s_file.close();
+        return false;
+    }
+
+    s_pData = pData;
+    qInfo() << "Paquet d'images projeté en mémoire :" << rPackPath;
+    return true;
+}
+
+//! Ferme le paquet ouvert, s'il y en a un.
+void AssetPack::close() {
+    if (s_pData != nullptr) {
+        s_file.unmap(const_cast<uchar*>(s_pData));
+        s_pData = nullptr;
+    }
+    s_file.close();
+}
+
+//! \return un booléen qui indique si le paquet ouvert contient l'image donnée.
+bool AssetPack::contains(AssetRegistry::AssetId assetId) {
+    return isOpen() && indexEntry(assetId).width > 0 && indexEntry(assetId).height > 0;
+}
+
+//! \return l'image donnée, qui référence directement les pixels du paquet projeté en
+//! mémoire (sans copie), ou une image nulle si le paquet ne la contient pas.
+QImage AssetPack::image(AssetRegistry::AssetId assetId) {
+    if (!contains(assetId))
+        return QImage();
+
+    const IndexEntry& rEntry = indexEntry(assetId);
+    return QImage(s_pData + rEntry.dataOffset, static_cast<int>(rEntry.width), static_cast<int>(rEntry.height),
+                  static_cast<qsizetype>(rEntry.bytesPerLine), QImage::Format_ARGB32_Premultiplied);
+}
+
+//! \return l'empreinte (FNV-1a) du chemin donné.
+quint32 AssetPack::pathHash(const char* pFileName) {
+    quint32 hash = 2166136261u;
+    for (const char* pChar = pFileName; *pChar != '\0'; pChar++) {
+        hash ^= static_cast<uchar>(*pChar);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+//! \return l'entrée de l'index du paquet ouvert pour l'image donnée.
+const AssetPack::IndexEntry& AssetPack::indexEntry(AssetRegistry::AssetId assetId) {
+    Q_ASSERT(isOpen() && assetId >= 0 && assetId < AssetRegistry::ASSET_COUNT);
+    return reinterpret_cast<const IndexEntry*>(s_pData + sizeof(Header))[assetId];
+}
@@ -0,0 +1,81 @@
+/**
+  \file
+  \brief    Déclaration de la classe AssetPack.
+  \date     octobre 2026
+*/
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <QFile>
+#include <QImage>
+#include <QString>
+
+#include "assetregistry.h"
+
+//! \brief Paquet des images du jeu, déjà décodées, lu par projection en mémoire.
+//!
+//! Le paquet est un fichier unique qui contient toutes les images du registre
+//! (AssetRegistry), décodées au format ARGB32 prémultiplié, celui de l'atlas de textures.
+//! Il est construit par build(), depuis les fichiers de `res/images`, avec l'option
+//! `--build-asset-pack` de la ligne de commande ou la cible `make assetpack`.
+//!
+//! Le fichier se compose :
+//! - d'un en-tête (Header) : signature, version, ordre des octets et nombre d'images ;
+//! - d'un index (IndexEntry), une entrée par AssetId, dans l'ordre du registre ;
+//! - des pixels de chaque image, alignés sur DATA_ALIGNMENT octets.
+//!
+//! open() projette le fichier en mémoire (QFile::map()) sans le lire : image() retourne
+//! alors une QImage qui référence directement les pixels projetés, sans copie ni
+//! décodage. Les pages du fichier ne sont lues qu'au moment où l'atlas y copie les images.
+//!
+//! Chaque entrée de l'index contient une empreinte du chemin de son image : un paquet
+//! construit avec un autre registre est refusé par open(). Les images qui n'y figurent
+//! pas (contains()) sont chargées depuis leur fichier, ce qui permet de développer sans
+//! paquet ou avec un paquet incomplet (voir AssetPreloader).
+//!
+//! Le paquet ne doit être utilisé que depuis le thread de l'interface graphique. Les
+//! images retournées par image() ne doivent plus être utilisées après close().
+class AssetPack
+{
+public:
+    static const quint32 VERSION = 1;
+    static const int DATA_ALIGNMENT = 16;
+
+    static QString defaultPath();
+    static bool build(const QString& rPackPath);
+
+    static bool open(const QString& rPackPath);
+    static void close();
+    static bool isOpen() { return s_pData != nullptr; }
+
+    static bool contains(AssetRegistry::AssetId assetId);
+    static QImage image(AssetRegistry::AssetId assetId);
+
+private:
+    AssetPack() = delete;
+
+    //! En-tête du paquet.
+    struct Header {
+        char magic[4];
+        quint32 version;
+        quint32 byteOrderMark;
+        quint32 assetCount;
+    };
+
+    //! Entrée de l'index : une image du registre.
+    struct IndexEntry {
+        quint32 pathHash;       //!< Empreinte du chemin (AssetRegistry::FILE_NAMES).
+        quint32 width;          //!< Largeur, nulle si l'image n'a pas pu être lue.
+        quint32 height;
+        quint32 bytesPerLine;
+        quint64 dataOffset;     //!< Position des pixels depuis le début du fichier.
+    };
+
+    static quint32 pathHash(const char* pFileName);
+    static const IndexEntry& indexEntry(AssetRegistry::AssetId assetId);
+
+    static QFile s_file;
+    static const uchar* s_pData;
+};
+
+#endif // ASSETPACK_H
@@ -0,0 +1,244 @@
+/**
+  \file
+  \brief    Définition de la classe AssetPreloader.
+  \date     octobre 2026
+*/
+#include "assetpreloader.h"
+
+#include <memory>
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QImage>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
+
+#include "assetcache.h"
+#include "assetpack.h"
+#include "textureatlas.h"
+#include "tracerecorder.h"
+
+namespace {
+
+//! Images d'un appel à preload() : elles sont publiées ensemble, une fois toutes décodées,
+//! afin d'être rangées dans les mêmes pages de l'atlas.
+struct Batch {
+    QVector<TextureAtlas::SourceImage> images;
+    int pendingCount;
+};
+
+typedef std::shared_ptr<Batch> BatchPointer;
+
+// Lots en cours de décodage ou décodés mais pas encore publiés.
+QMutex s_mutex;
+QWaitCondition s_batchDecoded;
+QList<BatchPointer> s_pendingBatches;
+
+// Utilisés uniquement depuis le thread de l'interface graphique.
+QSet<QString> s_requestedPaths;
+QSet<QString> s_publishedPaths;
+
+//! \return les chemins complets des images de l'ensemble donné.
+QStringList imagePaths(AssetPreloader::AssetSet set) {
+    QStringList paths;
+    for (AssetRegistry::AssetId assetId : AssetPreloader::manifest(set))
+        paths << AssetRegistry::path(assetId);
+    return paths;
+}
+
+//! \return un booléen qui indique si un lot est entièrement décodé.
+//! Doit être appelé avec s_mutex verrouillé.
+bool hasDecodedBatch() {
+    for (const BatchPointer& pBatch : std::as_const(s_pendingBatches)) {
+        if (pBatch->pendingCount == 0)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+//! \return les images de l'ensemble donné.
+QVector<AssetRegistry::AssetId> AssetPreloader::manifest(AssetSet set) {
+    switch (set) {
+    case MENU_ASSETS:
+        return { AssetRegistry::LINK_DOWN_1, AssetRegistry::LINK_DOWN_2, AssetRegistry::LINK_UP_1, AssetRegistry::LINK_UP_2,
+                 AssetRegistry::LINK_LEFT_1, AssetRegistry::LINK_LEFT_2, AssetRegistry::LINK_RIGHT_1, AssetRegistry::LINK_RIGHT_2,
+                 AssetRegistry::HEART,
+                 AssetRegistry::HEART_DROP_1, AssetRegistry::HEART_DROP_2, AssetRegistry::BLUE_RING, AssetRegistry::RED_RING,
+                 AssetRegistry::TRIFORCE_1, AssetRegistry::TRIFORCE_2,
+                 AssetRegistry::LEEVER_1, AssetRegistry::LEEVER_2, AssetRegistry::RED_LEEVER_1, AssetRegistry::RED_LEEVER_2,
+                 AssetRegistry::OCTOPUS_1, AssetRegistry::OCTOPUS_2 };
+    case GAMEPLAY_ASSETS:
+        return { AssetRegistry::LEEVER_1, AssetRegistry::LEEVER_2, AssetRegistry::RED_LEEVER_1, AssetRegistry::RED_LEEVER_2,
+                 AssetRegistry::OCTOPUS_1, AssetRegistry::OCTOPUS_2,
+                 AssetRegistry::SWORD, AssetRegistry::ROCK_PROJECTILE,
+                 AssetRegistry::CLOUD_1, AssetRegistry::CLOUD_2, AssetRegistry::CLOUD_3, AssetRegistry::CLOUD_4,
+                 AssetRegistry::CLOUD_5, AssetRegistry::CLOUD_6, AssetRegistry::CLOUD_7,
+                 AssetRegistry::HEART_DROP_1, AssetRegistry::HEART_DROP_2, AssetRegistry::BLUE_RING, AssetRegistry::RED_RING,
+                 AssetRegistry::TRIFORCE_1, AssetRegistry::TRIFORCE_2 };
+    case LEVEL_1_ASSETS:
+        return { AssetRegistry::BUSH, AssetRegistry::ROCK };
+    case LEVEL_2_ASSETS:
+        return { AssetRegistry::BUSH, AssetRegistry::ROCK, AssetRegistry::WATER_BORDER_UP, AssetRegistry::WATER_BORDER_DOWN };
+    case LEVEL_3_ASSETS:
+        return { AssetRegistry::WHITE_ROCK, AssetRegistry::WHITE_BUSH, AssetRegistry::FIRE_1, AssetRegistry::FIRE_2 };
+    case ASSET_SET_COUNT:
+        break;
+    }
+    return {};
+}
+
+//! Lance le décodage en arrière-plan des images de l'ensemble donné.
+//! Les images déjà demandées, ou déjà présentes dans l'atlas ou le cache, sont ignorées.
+//! Les images du paquet d'images (AssetPack), s'il est ouvert, ne sont pas décodées :
+//! elles sont prises telles quelles dans le paquet projeté en mémoire.
+//! Les ensembles demandés en premier (dans l'ordre de AssetSet) sont décodés en priorité.
+//! \param set  Ensemble d'images à précharger.
+void AssetPreloader::preload(AssetSet set) {
+    QVector<TextureAtlas::SourceImage> packedImages;
+    QStringList newPaths;
+    for (AssetRegistry::AssetId assetId : manifest(set)) {
+        const QString& rPath = AssetRegistry::path(assetId);
+        if (s_requestedPaths.contains(rPath))
+            continue;
+        s_requestedPaths.insert(rPath);
+        if (TextureAtlas::contains(rPath) || AssetCache::contains(rPath))
+            s_publishedPaths.insert(rPath);
+        else if (AssetPack::contains(assetId))
+            packedImages.append(TextureAtlas::SourceImage { rPath, AssetPack::image(assetId) });
+        else
+            newPaths << rPath;
+    }
+    if (packedImages.isEmpty() && newPaths.isEmpty())
+        return;
+
+    BatchPointer pBatch = std::make_shared<Batch>();
+    pBatch->images = packedImages;
+    pBatch->images.reserve(packedImages.count() + newPaths.count());
+    pBatch->pendingCount = static_cast<int>(newPaths.count());
+    {
+        QMutexLocker locker(&s_mutex);
+        s_pendingBatches.append(pBatch);
+    }
+    if (newPaths.isEmpty()) {
+        // Toutes les images viennent du paquet : le lot est complet.
+        QMetaObject::invokeMethod(QCoreApplication::instance(), &AssetPreloader::publishDecodedBatches,
+                                  Qt::QueuedConnection);
+        return;
+    }
+
+    for (const QString& rPath : std::as_const(newPaths)) {
+        QThreadPool::globalInstance()->start([pBatch, rPath]() {
+            QImage image(rPath);
+            if (!image.isNull())
+                image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+            QMutexLocker locker(&s_mutex);
+            pBatch->images.append(TextureAtlas::SourceImage { rPath, image });
+            if (--pBatch->pendingCount == 0) {
+                s_batchDecoded.wakeAll();
+                QMetaObject::invokeMethod(QCoreApplication::instance(), &AssetPreloader::publishDecodedBatches,
+                                          Qt::QueuedConnection);
+            }
+        }, ASSET_SET_COUNT - set);
+    }
+}
+
+//! Lance le préchargement de tous les ensembles d'images, dans l'ordre de AssetSet.
+void AssetPreloader::preloadAll() {
+    for (int set = 0; set < ASSET_SET_COUNT; set++)
+        preload(static_cast<AssetSet>(set));
+}
+
+//! Attend que toutes les images de l'ensemble donné soient publiées (dans l'atlas ou
+//! dans le cache), en lançant leur préchargement si ce n'est pas déjà fait.
+//! \param set  Ensemble d'images attendu.
+void AssetPreloader::waitFor(AssetSet set) {
+    preload(set);
+
+    TraceZone zone("AssetPreloader::waitFor");
+    for (;;) {
+        publishDecodedBatches();
+        if (isLoaded(set))
+            return;
+
+        QMutexLocker locker(&s_mutex);
+        while (!hasDecodedBatch())
+            s_batchDecoded.wait(&s_mutex);
+    }
+}
+
+//! \return un booléen qui indique si toutes les images de l'ensemble donné sont publiées.
+bool AssetPreloader::isLoaded(AssetSet set) {
+    for (const QString& rPath : imagePaths(set)) {
+        if (!s_publishedPaths.contains(rPath))
+            return false;
+    }
+    return true;
+}
+
+//! \return le nombre d'images dont le préchargement a été demandé.
+int AssetPreloader::requestedCount() {
+    return static_cast<int>(s_requestedPaths.count());
+}
+
+//! \return le nombre d'images préchargées et publiées.
+int AssetPreloader::publishedCount() {
+    return static_cast<int>(s_publishedPaths.count());
+}
+
+//! Attend la fin des décodages en cours et oublie les images préchargées.
+//! Les images publiées restent dans l'atlas et le cache, qui doivent être vidés à part.
+void AssetPreloader::clear() {
+    QThreadPool::globalInstance()->waitForDone();
+
+    QMutexLocker locker(&s_mutex);
+    s_pendingBatches.clear();
+    s_requestedPaths.clear();
+    s_publishedPaths.clear();
+}
+
+//! Publie les lots entièrement décodés : les petites images sont ajoutées ensemble à
+//! l'atlas de textures, les autres au cache AssetCache.
+//! Appelé depuis le thread de l'interface graphique, où les QPixmap sont créés.
+void AssetPreloader::publishDecodedBatches() {
+    QList<BatchPointer> decodedBatches;
+    {
+        QMutexLocker locker(&s_mutex);
+        for (auto it = s_pendingBatches.begin(); it != s_pendingBatches.end(); ) {
+            if ((*it)->pendingCount == 0) {
+                decodedBatches.append(*it);
+                it = s_pendingBatches.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    if (decodedBatches.isEmpty())
+        return;
+
+    for (const BatchPointer& pBatch : std::as_const(decodedBatches)) {
+        QVector<TextureAtlas::SourceImage> atlasImages;
+        for (const TextureAtlas::SourceImage& rSource : std::as_const(pBatch->images)) {
+            if (rSource.image.isNull()) {
+                qWarning() << "Image introuvable :" << rSource.path;
+                AssetCache::insert(rSource.path, QPixmap());
+            } else if (rSource.image.width() <= TextureAtlas::MAX_FRAME_SIZE
+                       && rSource.image.height() <= TextureAtlas::MAX_FRAME_SIZE) {
+                atlasImages.append(rSource);
+            } else {
+                AssetCache::insert(rSource.path, QPixmap::fromImage(rSource.image));
+            }
+        }
+        TextureAtlas::add(atlasImages);
+
+        for (const TextureAtlas::SourceImage& rSource : std::as_const(pBatch->images))
+            s_publishedPaths.insert(rSource.path);
+    }
+}
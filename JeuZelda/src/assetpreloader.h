@@ -0,0 +1,71 @@
+/**
+  \file
+  \brief    Déclaration de la classe AssetPreloader.
+  \date     octobre 2026
+*/
+#ifndef ASSETPRELOADER_H
+#define ASSETPRELOADER_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "assetregistry.h"
+
+//! \brief Précharge en arrière-plan les images du jeu, selon un manifeste.
+//!
+//! Le manifeste (manifest()) répartit les images du jeu (AssetRegistry) en ensembles (AssetSet) :
+//! celles de l'écran de démarrage, celles de toutes les parties (joueur, ennemis,
+//! projectiles, objets) et celles du décor de chaque niveau.
+//!
+//! preload() confie le décodage des images d'un ensemble aux threads du QThreadPool
+//! global, qui produisent des QImage au format ARGB32 prémultiplié. Si le paquet
+//! d'images (AssetPack) est ouvert, les images qu'il contient sont déjà à ce format et
+//! ne sont pas décodées : seules les autres sont lues depuis leurs fichiers. Lorsque toutes les
+//! images d'un même appel sont décodées, elles sont publiées depuis le thread de
+//! l'interface graphique (où seuls les QPixmap peuvent être créés) : les petites images
+//! sont ajoutées ensemble à l'atlas de textures (TextureAtlas::add()), les autres au
+//! cache AssetCache. Une image introuvable est mémorisée comme image nulle par
+//! AssetCache, afin qu'elle ne soit plus cherchée sur le disque.
+//!
+//! waitFor() bloque jusqu'à ce que les images d'un ensemble soient publiées : GameCore
+//! l'appelle avant de créer l'écran de démarrage puis avant de créer chaque niveau.
+//! Comme tous les ensembles sont préchargés dès le lancement, les niveaux sont en
+//! général prêts bien avant que le joueur les choisisse, et leur création ne lit plus
+//! aucun fichier.
+//!
+//! publishedCount() et requestedCount() donnent l'avancement du préchargement.
+//!
+//! Toutes les méthodes doivent être appelées depuis le thread de l'interface graphique.
+//! clear() doit être appelé avant la destruction de QApplication.
+class AssetPreloader
+{
+public:
+    enum AssetSet {
+        MENU_ASSETS,        //!< Écran de démarrage (joueur, objets et ennemis présentés).
+        GAMEPLAY_ASSETS,    //!< Toutes les parties (ennemis, projectiles, nuages, objets).
+        LEVEL_1_ASSETS,     //!< Décor du niveau 1.
+        LEVEL_2_ASSETS,     //!< Décor du niveau 2.
+        LEVEL_3_ASSETS,     //!< Décor du niveau 3.
+        ASSET_SET_COUNT
+    };
+
+    static QVector<AssetRegistry::AssetId> manifest(AssetSet set);
+
+    static void preload(AssetSet set);
+    static void preloadAll();
+    static void waitFor(AssetSet set);
+    static bool isLoaded(AssetSet set);
+
+    static int requestedCount();
+    static int publishedCount();
+
+    static void clear();
+
+private:
+    AssetPreloader() = delete;
+
+    static void publishDecodedBatches();
+};
+
+#endif // ASSETPRELOADER_H
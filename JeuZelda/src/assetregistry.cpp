@@ -0,0 +1,54 @@
+/**
+  \file
+  \brief    Définition de la classe AssetRegistry.
+  \date     octobre 2026
+*/
+#include "assetregistry.h"
+
+#include "resources.h"
+
+// La table des chemins doit suivre l'ordre de AssetId.
+static_assert(AssetRegistry::assetId("JeuZelda/Bush.png") == AssetRegistry::BUSH, "Table des images désordonnée");
+static_assert(AssetRegistry::assetId("JeuZelda/Cloud1.png") == AssetRegistry::CLOUD_1, "Table des images désordonnée");
+static_assert(AssetRegistry::assetId("JeuZelda/RightLink_2.gif") == AssetRegistry::LINK_RIGHT_2, "Table des images désordonnée");
+
+QVector<QString> AssetRegistry::s_paths;
+QVector<SpriteFrame> AssetRegistry::s_frames;
+
+//! \return le chemin complet de l'image donnée.
+const QString& AssetRegistry::path(AssetId assetId) {
+    Q_ASSERT(assetId >= 0 && assetId < ASSET_COUNT);
+    if (s_paths.isEmpty())
+        resolvePaths();
+    return s_paths.at(assetId);
+}
+
+//! \return l'image d'animation de l'image donnée (voir TextureAtlas::frame()).
+//! L'image d'animation est mémorisée dès que l'image fait partie de l'atlas : les appels
+//! suivants ne font alors plus de recherche dans l'atlas.
+SpriteFrame AssetRegistry::frame(AssetId assetId) {
+    const QString& rPath = path(assetId);
+    const SpriteFrame& rCachedFrame = s_frames.at(assetId);
+    if (rCachedFrame.isInAtlas())
+        return rCachedFrame;
+
+    const SpriteFrame assetFrame = TextureAtlas::frame(rPath);
+    if (assetFrame.isInAtlas())
+        s_frames[assetId] = assetFrame;
+    return assetFrame;
+}
+
+//! Oublie les chemins et les images d'animation mémorisés.
+void AssetRegistry::clear() {
+    s_paths.clear();
+    s_frames.clear();
+}
+
+//! Construit le chemin complet de chaque image.
+void AssetRegistry::resolvePaths() {
+    const QString imagesPath = GameFramework::imagesPath();
+    s_paths.reserve(ASSET_COUNT);
+    for (const char* pFileName : FILE_NAMES)
+        s_paths << imagesPath + QString::fromLatin1(pFileName);
+    s_frames.fill(SpriteFrame(), ASSET_COUNT);
+}
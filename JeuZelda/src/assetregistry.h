@@ -0,0 +1,150 @@
+/**
+  \file
+  \brief    Déclaration de la classe AssetRegistry.
+  \date     octobre 2026
+*/
+#ifndef ASSETREGISTRY_H
+#define ASSETREGISTRY_H
+
+#include <QString>
+#include <QVector>
+
+#include "textureatlas.h"
+
+//! \brief Registre des images du jeu, désignées par un identifiant entier (AssetId).
+//!
+//! Les images du répertoire `res/images/JeuZelda` sont énumérées par AssetId, dans le
+//! même ordre que la table FILE_NAMES, qui donne leur chemin relatif au répertoire des
+//! images (GameFramework::imagesPath()). assetId() retrouve l'identifiant d'une image
+//! d'après ce chemin ; comme cette recherche peut être évaluée à la compilation, elle
+//! permet de vérifier la table par des static_assert.
+//!
+//! Les chemins complets sont construits une seule fois, au premier appel à path() ou
+//! frame() : le code qui crée des sprites n'assemble ainsi plus de chaîne de caractères
+//! et ne calcule plus de clé de hachage. frame() mémorise de plus l'image d'animation de
+//! chaque image dès qu'elle fait partie de l'atlas de textures.
+//!
+//! Le registre ne doit être utilisé que depuis le thread de l'interface graphique, après
+//! la création de QApplication. clear() doit être appelé avant TextureAtlas::clear().
+class AssetRegistry
+{
+public:
+    enum AssetId {
+        BUSH,
+        ROCK,
+        WATER_BORDER_UP,
+        WATER_BORDER_DOWN,
+        WHITE_ROCK,
+        WHITE_BUSH,
+        FIRE_1,
+        FIRE_2,
+        HEART,
+        HEART_DROP_1,
+        HEART_DROP_2,
+        BLUE_RING,
+        RED_RING,
+        TRIFORCE_1,
+        TRIFORCE_2,
+        LEEVER_1,
+        LEEVER_2,
+        RED_LEEVER_1,
+        RED_LEEVER_2,
+        OCTOPUS_1,
+        OCTOPUS_2,
+        SWORD,
+        ROCK_PROJECTILE,
+        CLOUD_1,
+        CLOUD_2,
+        CLOUD_3,
+        CLOUD_4,
+        CLOUD_5,
+        CLOUD_6,
+        CLOUD_7,
+        LINK_DOWN_1,
+        LINK_DOWN_2,
+        LINK_UP_1,
+        LINK_UP_2,
+        LINK_LEFT_1,
+        LINK_LEFT_2,
+        LINK_RIGHT_1,
+        LINK_RIGHT_2,
+        ASSET_COUNT
+    };
+
+    //! Chemins des images, relatifs au répertoire des images, dans l'ordre de AssetId.
+    static constexpr const char* FILE_NAMES[] = {
+        "JeuZelda/Bush.png",
+        "JeuZelda/Rock.png",
+        "JeuZelda/WaterBorderUp.png",
+        "JeuZelda/WaterBorderDown.png",
+        "JeuZelda/WhiteRock.png",
+        "JeuZelda/WhiteBush.png",
+        "JeuZelda/Fire_1.gif",
+        "JeuZelda/Fire_2.gif",
+        "JeuZelda/Coeur.png",
+        "JeuZelda/HearthOnGround1.gif",
+        "JeuZelda/HearthOnGround2.gif",
+        "JeuZelda/BlueRing.png",
+        "JeuZelda/RedRing.png",
+        "JeuZelda/Triforce1.gif",
+        "JeuZelda/Triforce2.gif",
+        "JeuZelda/Ennemi1_1.gif",
+        "JeuZelda/ennemi1_2.gif",
+        "JeuZelda/Ennemi2_1.gif",
+        "JeuZelda/ennemi2_2.gif",
+        "JeuZelda/EnnemiOctopus_1.gif",
+        "JeuZelda/EnnemiOctopus_2.gif",
+        "JeuZelda/ZeldaSpriteSword.png",
+        "JeuZelda/RockProjectil.png",
+        "JeuZelda/Cloud1.png",
+        "JeuZelda/Cloud2.png",
+        "JeuZelda/Cloud3.png",
+        "JeuZelda/Cloud4.png",
+        "JeuZelda/Cloud5.png",
+        "JeuZelda/Cloud6.png",
+        "JeuZelda/Cloud7.png",
+        "JeuZelda/DownLink_1.gif",
+        "JeuZelda/DownLink_2.gif",
+        "JeuZelda/UpLink_1.gif",
+        "JeuZelda/UpLink_2.gif",
+        "JeuZelda/LeftLink_1.gif",
+        "JeuZelda/LeftLink_2.gif",
+        "JeuZelda/RightLink_1.gif",
+        "JeuZelda/RightLink_2.gif"
+    };
+
+    //! \return l'identifiant de l'image dont le chemin (relatif au répertoire des images)
+    //! est donné, ou ASSET_COUNT si elle ne fait pas partie du registre.
+    static constexpr AssetId assetId(const char* pFileName) {
+        for (int id = 0; id < ASSET_COUNT; id++) {
+            if (isSameName(FILE_NAMES[id], pFileName))
+                return static_cast<AssetId>(id);
+        }
+        return ASSET_COUNT;
+    }
+
+    static const QString& path(AssetId assetId);
+    static SpriteFrame frame(AssetId assetId);
+    static void clear();
+
+private:
+    AssetRegistry() = delete;
+
+    static constexpr bool isSameName(const char* pName, const char* pOtherName) {
+        while (*pName != '\0' && *pName == *pOtherName) {
+            pName++;
+            pOtherName++;
+        }
+        return *pName == *pOtherName;
+    }
+
+    static void resolvePaths();
+
+    static QVector<QString> s_paths;
+    static QVector<SpriteFrame> s_frames;
+};
+
+static_assert(sizeof(AssetRegistry::FILE_NAMES) / sizeof(AssetRegistry::FILE_NAMES[0]) == AssetRegistry::ASSET_COUNT,
+              "AssetRegistry::FILE_NAMES doit avoir une entrée par AssetId");
+
+#endif // ASSETREGISTRY_H
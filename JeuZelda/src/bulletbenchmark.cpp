@@ -0,0 +1,128 @@
+/**
+  \file
+  \brief    Définition de la classe BulletBenchmark.
+  \date     octobre 2026
+*/
+#include "bulletbenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+#include <QRectF>
+#include <QtDebug>
+
+#include "assetpreloader.h"
+#include "bulletengine.h"
+#include "randomstream.h"
+
+const int TICK_COUNT = 600;
+const int TICK_DURATION = 16;
+const double TICK_BUDGET = 1000.0 / 60.0;
+const double WORLD_WIDTH = 1280.0;
+const double WORLD_HEIGHT = 720.0;
+const double MAX_SPEED = 400.0;
+const double PLAYER_SIZE = 64.0;
+const int DECOR_COUNT = 12;
+const double DECOR_SIZE = 96.0;
+const quint64 RANDOM_SEED = 2026;
+
+//! Remplit le moteur de projectiles, le simule et écrit les durées de chaque étape
+//! dans la sortie de log.
+//! \param bulletCount  Nombre de projectiles en vol, maintenu durant toute la mesure.
+//! \return 0 si la mesure a pu avoir lieu, 1 si l'image des projectiles est introuvable.
+int BulletBenchmark::run(int bulletCount) {
+    bulletCount = qBound(1, bulletCount, BulletEngine::MAX_BULLET_COUNT);
+
+    // Le moteur dessine ses projectiles depuis l'image du rocher, dans l'atlas.
+    AssetPreloader::preload(AssetPreloader::GAMEPLAY_ASSETS);
+    AssetPreloader::waitFor(AssetPreloader::GAMEPLAY_ASSETS);
+
+    RandomStream random(RANDOM_SEED);
+    const QRectF bounds(0.0, 0.0, WORLD_WIDTH, WORLD_HEIGHT);
+    const auto spawnBullet = [&random](BulletEngine& rEngine) {
+        const QPointF position(random.bounded(WORLD_WIDTH), random.bounded(WORLD_HEIGHT));
+        const QPointF velocity(random.bounded(2.0 * MAX_SPEED) - MAX_SPEED, random.bounded(2.0 * MAX_SPEED) - MAX_SPEED);
+        return rEngine.spawn(position, velocity);
+    };
+
+    BulletEngine engine(bounds);
+    if (!spawnBullet(engine)) {
+        qWarning() << "Image des projectiles introuvable : banc d'essai impossible.";
+        return 1;
+    }
+    while (engine.count() < bulletCount)
+        spawnBullet(engine);
+
+    // Cibles de la passe de collision, dans le même ordre que dans GameCore : le joueur,
+    // son épée, puis le décor.
+    QVector<QRectF> targets;
+    const QPointF center(WORLD_WIDTH / 2.0, WORLD_HEIGHT / 2.0);
+    targets.append(QRectF(center.x() - PLAYER_SIZE / 2.0, center.y() - PLAYER_SIZE / 2.0, PLAYER_SIZE, PLAYER_SIZE));
+    targets.append(QRectF(center.x() + PLAYER_SIZE / 2.0, center.y() - PLAYER_SIZE / 8.0, PLAYER_SIZE, PLAYER_SIZE / 4.0));
+    for (int i = 0; i < DECOR_COUNT; ++i)
+        targets.append(QRectF(random.bounded(WORLD_WIDTH - DECOR_SIZE), random.bounded(WORLD_HEIGHT - DECOR_SIZE), DECOR_SIZE, DECOR_SIZE));
+
+    QImage image(static_cast<int>(WORLD_WIDTH), static_cast<int>(WORLD_HEIGHT), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+
+    QVector<double> tickTimes;
+    QVector<double> collideTimes;
+    QVector<double> paintTimes;
+    QVector<double> totalTimes;
+    QVector<int> hitCounts;
+    qint64 removedCount = 0;
+    QElapsedTimer timer;
+    for (int tick = 0; tick < TICK_COUNT; ++tick) {
+        // Remplacement des projectiles retirés au tick précédent, hors mesure.
+        removedCount += bulletCount - engine.count();
+        while (engine.count() < bulletCount)
+            spawnBullet(engine);
+
+        timer.start();
+        engine.tick(TICK_DURATION);
+        const qint64 tickEnd = timer.nsecsElapsed();
+        engine.collide(targets, hitCounts);
+        const qint64 collideEnd = timer.nsecsElapsed();
+        engine.paint(&painter, nullptr);
+        const qint64 paintEnd = timer.nsecsElapsed();
+
+        tickTimes << tickEnd / 1.0e6;
+        collideTimes << (collideEnd - tickEnd) / 1.0e6;
+        paintTimes << (paintEnd - collideEnd) / 1.0e6;
+        totalTimes << paintEnd / 1.0e6;
+    }
+    painter.end();
+
+    qInfo().noquote() << QString("Moteur de projectiles : %1 projectiles en vol, %2 cibles, %3 ticks de %4 ms (%5 projectiles retirés par tick)")
+                         .arg(bulletCount).arg(targets.count()).arg(TICK_COUNT).arg(TICK_DURATION)
+                         .arg(static_cast<double>(removedCount) / TICK_COUNT, 0, 'f', 1);
+    qInfo().noquote() << "Déplacement | " + distribution(tickTimes);
+    qInfo().noquote() << "Collisions  | " + distribution(collideTimes);
+    qInfo().noquote() << "Dessin      | " + distribution(paintTimes);
+    qInfo().noquote() << "Total       | " + distribution(totalTimes);
+
+    std::sort(totalTimes.begin(), totalTimes.end());
+    const double totalP95 = totalTimes.at(qBound(0, static_cast<int>(std::ceil(0.95 * totalTimes.count())) - 1,
+                                                 static_cast<int>(totalTimes.count()) - 1));
+    qInfo().noquote() << QString("Percentile 95 du total : %1 ms, soit %2 % d'un tick à 60 Hz (%3 ms)")
+                         .arg(totalP95, 0, 'f', 3).arg(100.0 * totalP95 / TICK_BUDGET, 0, 'f', 1)
+                         .arg(TICK_BUDGET, 0, 'f', 3);
+    return 0;
+}
+
+//! \return la moyenne, le percentile 95 et le maximum des durées données (en millisecondes).
+QString BulletBenchmark::distribution(QVector<double> values) {
+    std::sort(values.begin(), values.end());
+    double total = 0.0;
+    for (double value : std::as_const(values))
+        total += value;
+    const int p95Index = qBound(0, static_cast<int>(std::ceil(0.95 * values.count())) - 1, static_cast<int>(values.count()) - 1);
+    return QString("moyenne %1 ms | p95 %2 ms | max %3 ms")
+            .arg(total / values.count(), 0, 'f', 3)
+            .arg(values.at(p95Index), 0, 'f', 3)
+            .arg(values.last(), 0, 'f', 3);
+}
@@ -0,0 +1,42 @@
+/**
+  \file
+  \brief    Déclaration de la classe BulletBenchmark.
+  \date     octobre 2026
+*/
+#ifndef BULLETBENCHMARK_H
+#define BULLETBENCHMARK_H
+
+#include <QString>
+#include <QVector>
+
+//! \brief Banc d'essai du moteur de projectiles (BulletEngine), tick complet compris.
+//!
+//! Le moteur est rempli de projectiles (par défaut DEFAULT_BULLET_COUNT, l'objectif du
+//! moteur) aux positions et vitesses pseudo-aléatoires, mais reproductibles. Il est
+//! ensuite simulé pendant quelques centaines de ticks, sur un seul cœur, comme dans le
+//! jeu : à chaque tick, les projectiles sont déplacés et ceux qui sont sortis retirés
+//! (BulletEngine::tick()), la passe de collision teste le joueur, son épée et les
+//! rochers et buissons du décor (BulletEngine::collide()), puis tous les projectiles
+//! sont dessinés dans une image de la taille de la scène (BulletEngine::paint()).
+//! Les projectiles retirés sont remplacés entre deux ticks, hors mesure, afin que leur
+//! nombre reste constant.
+//!
+//! La durée moyenne et le percentile 95 de chaque étape et du total sont écrits dans la
+//! sortie de log, et comparés à la durée d'un tick à 60 Hz.
+//!
+//! Le banc d'essai est lancé par l'option `--bench-bullets` de la ligne de commande,
+//! suivie du nombre de projectiles. Les images du jeu doivent être disponibles.
+class BulletBenchmark
+{
+public:
+    static const int DEFAULT_BULLET_COUNT = 20000;
+
+    static int run(int bulletCount = DEFAULT_BULLET_COUNT);
+
+private:
+    BulletBenchmark() = delete;
+
+    static QString distribution(QVector<double> values);
+};
+
+#endif // BULLETBENCHMARK_H
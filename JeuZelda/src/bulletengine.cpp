@@ -0,0 +1,196 @@
+/**
+  \file
+  \brief    Définition de la classe BulletEngine.
+  \date     octobre 2026
+*/
+#include "bulletengine.h"
+
+#include <cmath>
+
+#include "assetregistry.h"
+#include "tracerecorder.h"
+
+//! Nombre de projectiles pour lequel la place est réservée dès la construction.
+const int INITIAL_CAPACITY = 1024;
+
+//! Construit un moteur dont les projectiles sont retirés lorsqu'ils sortent du
+//! rectangle donné (en général, la scène).
+BulletEngine::BulletEngine(const QRectF& rBounds, QGraphicsItem* pParent)
+    : QGraphicsItem(pParent), m_bounds(rBounds) {
+    m_buffer.reserve(INITIAL_CAPACITY);
+}
+
+//! Tire une salve du tireur donné.
+//! \param rEmitter     Tireur : sa salve et la rotation de ses salves, mise à jour.
+//! \param rOrigin      Point de départ des projectiles.
+//! \param facingAngle  Direction du tireur, en degrés (0 vers la droite, 90 vers le bas).
+//! \return le nombre de projectiles tirés.
+int BulletEngine::fire(BulletEmitter& rEmitter, const QPointF& rOrigin, qreal facingAngle) {
+    if (rEmitter.patternId == BulletPatterns::NO_PATTERN || !ensureFrame())
+        return 0;
+
+    const BulletPattern& rPattern = BulletPatterns::pattern(static_cast<BulletPatterns::PatternId>(rEmitter.patternId));
+    qreal firstAngle = 0.0;
+    qreal angleStep = 0.0;
+    switch (rPattern.shape) {
+    case BulletPattern::AIMED:
+        if (m_pTarget != nullptr) {
+            const QPointF toTarget = m_pTarget->globalBoundingRect().center() - rOrigin;
+            facingAngle = std::atan2(toTarget.y(), toTarget.x()) * 180.0 / M_PI;
+        }
+        Q_FALLTHROUGH();
+    case BulletPattern::SPREAD:
+        // Éventail centré sur la direction visée.
+        firstAngle = facingAngle;
+        if (rPattern.bulletCount > 1) {
+            firstAngle -= rPattern.arc / 2.0;
+            angleStep = rPattern.arc / (rPattern.bulletCount - 1);
+        }
+        break;
+    case BulletPattern::RING:
+    case BulletPattern::SPIRAL:
+        // Projectiles répartis sur le cercle, qui tourne d'une salve à la suivante.
+        firstAngle = rEmitter.phase;
+        angleStep = 360.0 / rPattern.bulletCount;
+        rEmitter.phase = std::fmod(rEmitter.phase + rPattern.spin, 360.0);
+        break;
+    }
+
+    int firedCount = 0;
+    for (int i = 0; i < rPattern.bulletCount; ++i) {
+        const qreal angle = (firstAngle + i * angleStep) * M_PI / 180.0;
+        const QPointF velocity(std::cos(angle) * rPattern.speed, std::sin(angle) * rPattern.speed);
+        if (!spawn(rOrigin, velocity))
+            break;
+        ++firedCount;
+    }
+    return firedCount;
+}
+
+//! Ajoute un projectile.
+//! \param rPosition  Centre du projectile.
+//! \param rVelocity  Vitesse du projectile, en pixels par seconde.
+//! \return un booléen qui indique si le projectile a été ajouté (false si le moteur
+//! contient déjà MAX_BULLET_COUNT projectiles).
+bool BulletEngine::spawn(const QPointF& rPosition, const QPointF& rVelocity) {
+    if (m_buffer.count() >= MAX_BULLET_COUNT || !ensureFrame())
+        return false;
+    m_buffer.add(rPosition, rVelocity, m_bulletSize);
+    return true;
+}
+
+//! Déplace tous les projectiles et retire ceux qui sont sortis de la scène.
+//! Seule la réunion de la zone dessinée au tick précédent et de celle des projectiles
+//! déplacés est à redessiner.
+//! \param elapsedTimeInMilliseconds  Temps de jeu écoulé depuis le tick précédent.
+void BulletEngine::tick(long long elapsedTimeInMilliseconds) {
+    if (m_buffer.count() == 0) {
+        // Efface les projectiles dessinés avant que le dernier soit retiré.
+        if (!m_paintedRect.isEmpty())
+            update(m_paintedRect);
+        m_paintedRect = QRectF();
+        return;
+    }
+
+    TraceZone zone("BulletEngine::tick");
+    if (m_buffer.step(elapsedTimeInMilliseconds, m_bounds) > 0) {
+        // En partant de la fin, le projectile qui prend la place d'un projectile retiré a
+        // déjà été examiné.
+        for (int slot = m_buffer.count() - 1; slot >= 0; --slot) {
+            if (m_buffer.isOutOfBounds(slot))
+                m_buffer.remove(slot);
+        }
+    }
+
+    const QRectF bulletsRect = bulletsBoundingRect();
+    update(m_paintedRect.united(bulletsRect));
+    m_paintedRect = bulletsRect;
+}
+
+//! Passe de collision : retire les projectiles qui touchent l'un des rectangles donnés.
+//! Un projectile qui en touche plusieurs n'est compté que pour le premier.
+//! \param rTargets     Rectangles à tester, en coordonnées de la scène.
+//! \param rHitCounts   Reçoit, pour chaque rectangle, le nombre de projectiles qui l'ont touché.
+void BulletEngine::collide(const QVector<QRectF>& rTargets, QVector<int>& rHitCounts) {
+    rHitCounts.fill(0, rTargets.count());
+    if (m_buffer.count() == 0 || rTargets.isEmpty())
+        return;
+
+    TraceZone zone("BulletEngine::collide");
+    const QSizeF bulletSize = m_bulletSize;
+    const QPointF halfSize(bulletSize.width() / 2.0, bulletSize.height() / 2.0);
+    for (int slot = m_buffer.count() - 1; slot >= 0; --slot) {
+        const QRectF bulletRect(m_buffer.position(slot) - halfSize, bulletSize);
+        for (int target = 0; target < rTargets.count(); ++target) {
+            if (rTargets.at(target).intersects(bulletRect)) {
+                ++rHitCounts[target];
+                m_buffer.remove(slot);
+                break;
+            }
+        }
+    }
+}
+
+//! Retire tous les projectiles.
+void BulletEngine::clear() {
+    m_buffer.clear();
+    if (!m_paintedRect.isEmpty())
+        update(m_paintedRect);
+    m_paintedRect = QRectF();
+}
+
+//! \return le rectangle dans lequel les projectiles peuvent être dessinés : toute la scène.
+QRectF BulletEngine::boundingRect() const {
+    return m_bounds;
+}
+
+//! Dessine tous les projectiles en un seul appel, depuis l'image du rocher.
+void BulletEngine::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget) {
+    Q_UNUSED(pOption);
+    Q_UNUSED(pWidget);
+    const int bulletCount = m_buffer.count();
+    if (bulletCount == 0 || m_frame.isNull())
+        return;
+
+    const QRectF sourceRect(m_frame.sourceRect());
+    m_fragments.resize(bulletCount);
+    for (int slot = 0; slot < bulletCount; ++slot) {
+        m_fragments[slot] = QPainter::PixmapFragment::create(m_buffer.position(slot), sourceRect,
+                                                             BULLET_SCALE_FACTOR, BULLET_SCALE_FACTOR);
+    }
+    pPainter->drawPixmapFragments(m_fragments.constData(), bulletCount, m_frame.sourcePixmap());
+}
+
+//! \return le plus petit rectangle qui contient tous les projectiles (vide s'il n'y en a
+//! aucun).
+QRectF BulletEngine::bulletsBoundingRect() const {
+    const int bulletCount = m_buffer.count();
+    if (bulletCount == 0)
+        return QRectF();
+
+    QPointF position = m_buffer.position(0);
+    qreal left = position.x();
+    qreal right = left;
+    qreal top = position.y();
+    qreal bottom = top;
+    for (int slot = 1; slot < bulletCount; ++slot) {
+        position = m_buffer.position(slot);
+        left = qMin(left, position.x());
+        right = qMax(right, position.x());
+        top = qMin(top, position.y());
+        bottom = qMax(bottom, position.y());
+    }
+    const qreal halfWidth = m_bulletSize.width() / 2.0;
+    const qreal halfHeight = m_bulletSize.height() / 2.0;
+    return QRectF(QPointF(left - halfWidth, top - halfHeight), QPointF(right + halfWidth, bottom + halfHeight));
+}
+
+//! Obtient l'image du rocher, une fois préchargée, et en déduit la taille des projectiles.
+//! \return un booléen qui indique si l'image est disponible.
+bool BulletEngine::ensureFrame() {
+    if (!m_frame.isInAtlas()) {
+        m_frame = AssetRegistry::frame(AssetRegistry::ROCK_PROJECTILE);
+        m_bulletSize = QSizeF(m_frame.size()) * BULLET_SCALE_FACTOR;
+    }
+    return !m_frame.isNull();
+}
@@ -0,0 +1,79 @@
+/**
+  \file
+  \brief    Déclaration de la classe BulletEngine.
+  \date     octobre 2026
+*/
+#ifndef BULLETENGINE_H
+#define BULLETENGINE_H
+
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QPointer>
+#include <QRectF>
+#include <QVector>
+
+#include "bulletpatterns.h"
+#include "projectilebuffer.h"
+#include "sprite.h"
+#include "textureatlas.h"
+
+//! \brief Moteur de projectiles : des milliers de projectiles sans sprite.
+//!
+//! Les projectiles tirés en salves (BulletPatterns) ne sont pas des Sprite : seuls leur
+//! centre et leur vitesse sont mémorisés, dans un ProjectileBuffer dont les traitements
+//! par lot les déplacent et détectent ceux qui sont sortis de la scène. Un projectile
+//! sorti est retiré.
+//!
+//! Le moteur est lui-même l'élément graphique qui dessine tous ses projectiles, en un
+//! seul appel à QPainter::drawPixmapFragments() depuis l'image du rocher dans l'atlas.
+//! À chaque tick, seule la zone qui contenait les projectiles et celle qui les contient
+//! désormais sont redessinées, et non toute la scène.
+//!
+//! collide() est la passe de collision du moteur : en un seul parcours des projectiles,
+//! elle retire ceux qui touchent l'un des rectangles donnés (le joueur, son épée, le
+//! décor) et compte les projectiles qui ont touché chacun d'eux.
+//!
+//! fire() tire une salve depuis un tireur (BulletEmitter) ; les salves visées (AIMED)
+//! sont dirigées vers la cible du moteur (setTarget()), ou tout droit si elle a été
+//! détruite.
+//!
+//! Le nombre de projectiles est limité à MAX_BULLET_COUNT : au-delà, les salves sont
+//! tronquées.
+class BulletEngine : public QGraphicsItem
+{
+public:
+    enum { BulletEngineType = UserType + 3 };
+
+    static constexpr int MAX_BULLET_COUNT = 32768;
+    static constexpr qreal BULLET_SCALE_FACTOR = 2.0;
+
+    explicit BulletEngine(const QRectF& rBounds, QGraphicsItem* pParent = nullptr);
+
+    void setTarget(Sprite* pTarget) { m_pTarget = pTarget; }
+
+    int fire(BulletEmitter& rEmitter, const QPointF& rOrigin, qreal facingAngle);
+    bool spawn(const QPointF& rPosition, const QPointF& rVelocity);
+    void tick(long long elapsedTimeInMilliseconds);
+    void collide(const QVector<QRectF>& rTargets, QVector<int>& rHitCounts);
+    void clear();
+
+    int count() const { return m_buffer.count(); }
+
+    virtual QRectF boundingRect() const override;
+    virtual void paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget = nullptr) override;
+    virtual int type() const override { return BulletEngineType; }
+
+private:
+    QRectF bulletsBoundingRect() const;
+    bool ensureFrame();
+
+    ProjectileBuffer m_buffer;
+    QRectF m_bounds;
+    QPointer<Sprite> m_pTarget;     // Remis à zéro si la cible est détruite.
+    SpriteFrame m_frame;
+    QSizeF m_bulletSize;
+    QRectF m_paintedRect;       // Zone des projectiles lors du dernier tick, à effacer au suivant.
+    QVector<QPainter::PixmapFragment> m_fragments;
+};
+
+#endif // BULLETENGINE_H
@@ -0,0 +1,34 @@
+/**
+  \file
+  \brief    Définition de la classe BulletPatterns.
+  \date     octobre 2026
+*/
+#include "bulletpatterns.h"
+
+namespace {
+
+//! Salves, dans l'ordre de BulletPatterns::PatternId.
+const BulletPattern PATTERNS[BulletPatterns::PATTERN_COUNT] = {
+    // forme                  nombre  vitesse  arc    rotation  cadence
+    { BulletPattern::SPREAD,  5,      300.0,   60.0,  0.0,      900 },  // OCTOROCK_SPREAD
+    { BulletPattern::AIMED,   3,      380.0,   20.0,  0.0,      700 },  // OCTOROCK_AIMED
+    { BulletPattern::RING,    12,     220.0,   0.0,   15.0,     1200 }, // OCTOROCK_RING
+    { BulletPattern::SPIRAL,  4,      260.0,   0.0,   17.0,     120 }   // OCTOROCK_SPIRAL
+};
+
+} // namespace
+
+//! \return la description de la salve donnée.
+const BulletPattern& BulletPatterns::pattern(PatternId patternId) {
+    Q_ASSERT(patternId >= 0 && patternId < PATTERN_COUNT);
+    return PATTERNS[patternId];
+}
+
+//! \return la salve des Octopus de la vague donnée, ou NO_PATTERN s'ils lancent un seul
+//! rocher. À partir de FIRST_PATTERN_WAVE, la salve change toutes les WAVES_PER_PATTERN
+//! vagues, en revenant à la première après la dernière.
+BulletPatterns::PatternId BulletPatterns::patternForWave(int wave) {
+    if (wave < FIRST_PATTERN_WAVE)
+        return NO_PATTERN;
+    return static_cast<PatternId>(((wave - FIRST_PATTERN_WAVE) / WAVES_PER_PATTERN) % PATTERN_COUNT);
+}
@@ -0,0 +1,64 @@
+/**
+  \file
+  \brief    Déclaration de la classe BulletPatterns.
+  \date     octobre 2026
+*/
+#ifndef BULLETPATTERNS_H
+#define BULLETPATTERNS_H
+
+#include <QtGlobal>
+
+//! \brief Description d'une salve de projectiles (voir BulletPatterns).
+struct BulletPattern {
+    enum Shape {
+        SPREAD,     //!< Éventail de arc degrés, centré sur la direction du tireur.
+        RING,       //!< Cercle complet, tourné de spin degrés à chaque salve.
+        AIMED,      //!< Éventail de arc degrés, centré sur la cible.
+        SPIRAL      //!< Branches réparties sur le cercle, tournées de spin degrés à chaque salve.
+    };
+
+    Shape shape;
+    int bulletCount;    //!< Nombre de projectiles d'une salve.
+    qreal speed;        //!< Vitesse des projectiles, en pixels par seconde.
+    qreal arc;          //!< Angle couvert par un éventail, en degrés.
+    qreal spin;         //!< Rotation d'une salve à la suivante, en degrés.
+    int fireInterval;   //!< Temps de jeu entre deux salves, en millisecondes.
+};
+
+//! \brief État d'un tireur : sa salve et la rotation accumulée de ses salves.
+struct BulletEmitter {
+    int patternId = -1;     //!< BulletPatterns::PatternId, ou NO_PATTERN.
+    qreal phase = 0.0;      //!< Rotation accumulée, en degrés (RING, SPIRAL).
+};
+
+//! \brief Salves de projectiles du moteur de projectiles (BulletEngine).
+//!
+//! Les salves sont décrites par des données (BulletPattern) : leur forme, leur nombre
+//! de projectiles, leur vitesse et leur cadence. patternForWave() donne la salve des
+//! Octopus d'une vague : aucune dans les premières vagues, où ils lancent un seul
+//! rocher (EnnemiOctopus::attack()), puis des salves de plus en plus denses.
+class BulletPatterns
+{
+public:
+    enum PatternId {
+        NO_PATTERN = -1,
+        OCTOROCK_SPREAD,
+        OCTOROCK_AIMED,
+        OCTOROCK_RING,
+        OCTOROCK_SPIRAL,
+        PATTERN_COUNT
+    };
+
+    //! Première vague dont les Octopus tirent des salves.
+    static constexpr int FIRST_PATTERN_WAVE = 10;
+    //! Nombre de vagues entre deux changements de salve.
+    static constexpr int WAVES_PER_PATTERN = 5;
+
+    static const BulletPattern& pattern(PatternId patternId);
+    static PatternId patternForWave(int wave);
+
+private:
+    BulletPatterns() = delete;
+};
+
+#endif // BULLETPATTERNS_H
@@ -0,0 +1,164 @@
+/**
+  \file
+  \brief    Définition de la classe CollisionBenchmark.
+  \date     octobre 2026
+*/
+#include "collisionbenchmark.h"
+
+#include <cmath>
+#include <QElapsedTimer>
+#include <QGraphicsScene>
+#include <QLoggingCategory>
+#include <QPixmap>
+#include <QRandomGenerator>
+#include <QVector>
+#include <QtDebug>
+
+#include "spatialhashgrid.h"
+#include "sprite.h"
+
+const int FRAME_COUNT = 10;
+const int SPRITE_SIZE = 16;
+const double SPRITE_SCALE = 2.0;
+const double AREA_PER_SPRITE = 128.0 * 128.0;
+const double MIN_WORLD_SIZE = 512.0;
+const double MAX_SPEED = 3.0;
+const quint32 RANDOM_SEED = 2026;
+
+namespace {
+
+//! Position et vitesse initiales d'un sprite du banc d'essai.
+struct SpriteMotion {
+    QPointF position;
+    QPointF velocity;
+};
+
+//! Génère des mouvements reproductibles pour le nombre de sprites donné.
+QVector<SpriteMotion> createMotions(int spriteCount, double worldSize) {
+    QRandomGenerator generator(RANDOM_SEED);
+    QVector<SpriteMotion> motions(spriteCount);
+    for (SpriteMotion& rMotion : motions) {
+        rMotion.position = QPointF(generator.bounded(worldSize), generator.bounded(worldSize));
+        rMotion.velocity = QPointF(generator.bounded(2.0 * MAX_SPEED) - MAX_SPEED,
+                                   generator.bounded(2.0 * MAX_SPEED) - MAX_SPEED);
+    }
+    return motions;
+}
+
+//! Crée les sprites du banc d'essai.
+QVector<Sprite*> createSprites(const QVector<SpriteMotion>& rMotions, const QPixmap& rPixmap) {
+    QVector<Sprite*> sprites;
+    sprites.reserve(rMotions.count());
+    for (const SpriteMotion& rMotion : rMotions) {
+        Sprite* pSprite = new Sprite(rPixmap);
+        pSprite->setScale(SPRITE_SCALE);
+        pSprite->setPos(rMotion.position);
+        sprites.append(pSprite);
+    }
+    return sprites;
+}
+
+//! Déplace chaque sprite selon sa vitesse, en restant dans la surface de jeu.
+void moveSprites(const QVector<Sprite*>& rSprites, QVector<SpriteMotion>& rMotions, double worldSize) {
+    for (int i = 0; i < rSprites.count(); ++i) {
+        SpriteMotion& rMotion = rMotions[i];
+        rMotion.position += rMotion.velocity;
+        if (rMotion.position.x() < 0.0 || rMotion.position.x() > worldSize)
+            rMotion.velocity.setX(-rMotion.velocity.x());
+        if (rMotion.position.y() < 0.0 || rMotion.position.y() > worldSize)
+            rMotion.velocity.setY(-rMotion.velocity.y());
+        rSprites[i]->setPos(rMotion.position);
+    }
+}
+
+} // namespace
+
+//! Lance le banc d'essai pour chacun des nombres de sprites donnés et écrit les
+//! résultats dans la sortie de log.
+//! \param rSpriteCounts  Nombres de sprites à tester.
+void CollisionBenchmark::run(const QList<int>& rSpriteCounts) {
+    // Chaque sprite créé ou détruit écrit un message de debug (DEBUG_SPRITE_COUNT) :
+    // ces messages sont masqués le temps du banc d'essai.
+    QLoggingCategory::setFilterRules(QStringLiteral("default.debug=false"));
+
+    qInfo().noquote() << QString("Détection de collisions : %1 images par mesure").arg(FRAME_COUNT);
+    qInfo().noquote() << QString("%1 | %2 | %3 | %4").arg(QStringLiteral("Sprites"), 8)
+                                                      .arg(QStringLiteral("BSP (ms/image)"), 15)
+                                                      .arg(QStringLiteral("Grille (ms/image)"), 18)
+                                                      .arg(QStringLiteral("Collisions"), 10);
+
+    for (int spriteCount : rSpriteCounts) {
+        Result result = measure(spriteCount);
+        qInfo().noquote() << QString("%1 | %2 | %3 | %4")
+                             .arg(spriteCount, 8)
+                             .arg(result.bspMillisecondsPerFrame, 15, 'f', 3)
+                             .arg(result.gridMillisecondsPerFrame, 18, 'f', 3)
+                             .arg(result.gridCollisionCount, 10);
+        if (result.bspCollisionCount != result.gridCollisionCount)
+            qWarning() << "Nombre de collisions différent : BSP" << result.bspCollisionCount
+                       << "grille" << result.gridCollisionCount;
+    }
+
+    QLoggingCategory::setFilterRules(QString());
+}
+
+//! Mesure le temps moyen d'une image (déplacements et recherche des collisions de
+//! chaque sprite) avec l'index BSP de Qt puis avec la grille spatiale.
+//! \param spriteCount  Nombre de sprites.
+//! \return les temps moyens par image et le nombre total de collisions trouvées.
+CollisionBenchmark::Result CollisionBenchmark::measure(int spriteCount) {
+    Result result = {};
+
+    const double worldSize = qMax(MIN_WORLD_SIZE, std::sqrt(spriteCount * AREA_PER_SPRITE));
+    QPixmap pixmap(SPRITE_SIZE, SPRITE_SIZE);
+    pixmap.fill(Qt::white);
+
+    QElapsedTimer timer;
+
+    // Index BSP de Qt.
+    {
+        QVector<SpriteMotion> motions = createMotions(spriteCount, worldSize);
+        QGraphicsScene scene(0, 0, worldSize, worldSize);
+        scene.setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+        QVector<Sprite*> sprites = createSprites(motions, pixmap);
+        for (Sprite* pSprite : std::as_const(sprites))
+            scene.addItem(pSprite);
+
+        timer.start();
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+            moveSprites(sprites, motions, worldSize);
+            for (Sprite* pSprite : std::as_const(sprites))
+                result.bspCollisionCount += scene.collidingItems(pSprite).count();
+        }
+        result.bspMillisecondsPerFrame = timer.nsecsElapsed() / 1.0e6 / FRAME_COUNT;
+        // Les sprites sont détruits par la scène.
+    }
+
+    // Grille spatiale.
+    {
+        QVector<SpriteMotion> motions = createMotions(spriteCount, worldSize);
+        SpatialHashGrid grid;
+        QVector<Sprite*> sprites = createSprites(motions, pixmap);
+        for (Sprite* pSprite : std::as_const(sprites))
+            grid.insert(pSprite);
+
+        QVector<Sprite*> candidates;
+        timer.start();
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+            moveSprites(sprites, motions, worldSize);
+            for (Sprite* pSprite : std::as_const(sprites)) {
+                candidates.resize(0);
+                grid.query(pSprite->sceneBoundingRect(), candidates);
+                for (Sprite* pCandidate : std::as_const(candidates)) {
+                    if (pCandidate != pSprite && pSprite->collidesWithItem(pCandidate))
+                        ++result.gridCollisionCount;
+                }
+            }
+        }
+        result.gridMillisecondsPerFrame = timer.nsecsElapsed() / 1.0e6 / FRAME_COUNT;
+
+        qDeleteAll(sprites);
+    }
+
+    return result;
+}
@@ -0,0 +1,47 @@
+/**
+  \file
+  \brief    Déclaration de la classe CollisionBenchmark.
+  \date     octobre 2026
+*/
+#ifndef COLLISIONBENCHMARK_H
+#define COLLISIONBENCHMARK_H
+
+#include <QList>
+
+//! \brief Banc d'essai comparant la grille spatiale (SpatialHashGrid) à l'index BSP de Qt.
+//!
+//! Pour chaque nombre de sprites demandé, les mêmes sprites (positions et vitesses
+//! pseudo-aléatoires, mais reproductibles) sont déplacés pendant quelques images.
+//! À chaque image, chaque sprite est déplacé puis les collisions de chaque sprite
+//! sont recherchées :
+//!
+//! - avec une QGraphicsScene utilisant son index par défaut (BspTreeIndex) et
+//!   QGraphicsScene::collidingItems() ;
+//! - avec une SpatialHashGrid, tenue à jour par les sprites eux-mêmes, suivie du
+//!   même test de forme (QGraphicsItem::collidesWithItem()).
+//!
+//! La densité de sprites est constante : la surface de jeu grandit avec le nombre
+//! de sprites.
+//!
+//! Le banc d'essai est lancé par l'option `--bench-collisions` de la ligne de
+//! commande (par exemple avec `-platform offscreen` pour ne pas ouvrir d'affichage).
+//! Les résultats sont écrits dans la sortie de log.
+class CollisionBenchmark
+{
+public:
+    static void run(const QList<int>& rSpriteCounts = QList<int>({ 10, 100, 1000, 10000 }));
+
+private:
+    CollisionBenchmark() = delete;
+
+    struct Result {
+        double bspMillisecondsPerFrame;
+        double gridMillisecondsPerFrame;
+        long long bspCollisionCount;
+        long long gridCollisionCount;
+    };
+
+    static Result measure(int spriteCount);
+};
+
+#endif // COLLISIONBENCHMARK_H
@@ -0,0 +1,106 @@
+/**
+  \file
+  \brief    Définition de la classe EnemyBenchmark.
+  \date     octobre 2026
+*/
+#include "enemybenchmark.h"
+
+#include <QElapsedTimer>
+#include <QSizeF>
+#include <QtDebug>
+
+#include "enemystore.h"
+#include "randomstream.h"
+#include "workerpool.h"
+
+const int TICK_COUNT = 600;
+const int TICK_DURATION = 16;
+const double WORLD_WIDTH = 1280.0;
+const double WORLD_HEIGHT = 720.0;
+const double ENEMY_SIZE = 64.0;
+const quint64 RANDOM_SEED = 2026;
+
+//! Lance le banc d'essai pour chacun des nombres d'ennemis donnés et écrit les
+//! résultats dans la sortie de log.
+//! \param rEnemyCounts  Nombres d'ennemis à simuler.
+void EnemyBenchmark::run(const QList<int>& rEnemyCounts) {
+    const int threadCount = WorkerPool::threadCount();
+    qInfo().noquote() << QString("Simulation des ennemis : %1 ticks de %2 ms par mesure, %3 thread(s) de calcul, %4 réflexions par tick au plus")
+                         .arg(TICK_COUNT).arg(TICK_DURATION).arg(threadCount).arg(EnemyStore::DEFAULT_THINK_BUDGET);
+    qInfo().noquote() << QString("%1 | %2 | %3 | %4 | %5 | %6 | %7 | %8").arg(QStringLiteral("Ennemis"), 8)
+                                                                        .arg(QStringLiteral("1 thread (ms)"), 14)
+                                                                        .arg(QStringLiteral("%1 threads (ms)").arg(threadCount), 15)
+                                                                        .arg(QStringLiteral("Gain"), 6)
+                                                                        .arg(QStringLiteral("Réflexions/tick"), 15)
+                                                                        .arg(QStringLiteral("Max"), 6)
+                                                                        .arg(QStringLiteral("Retard max (ms)"), 15)
+                                                                        .arg(QStringLiteral("Identique"), 9);
+
+    for (int enemyCount : rEnemyCounts) {
+        const Measurement singleThread = measure(enemyCount, 1);
+        const Measurement multiThread = measure(enemyCount, threadCount);
+        qInfo().noquote() << QString("%1 | %2 | %3 | %4 | %5 | %6 | %7 | %8").arg(enemyCount, 8)
+                                                                            .arg(singleThread.tickTime, 14, 'f', 4)
+                                                                            .arg(multiThread.tickTime, 15, 'f', 4)
+                                                                            .arg(singleThread.tickTime / qMax(multiThread.tickTime, 1.0e-9), 6, 'f', 2)
+                                                                            .arg(singleThread.averageThinkCount, 15, 'f', 1)
+                                                                            .arg(singleThread.maxThinkCount, 6)
+                                                                            .arg(singleThread.maxLatency, 15)
+                                                                            .arg(singleThread.stateHash == multiThread.stateHash ? QStringLiteral("oui") : QStringLiteral("NON"), 9);
+    }
+    WorkerPool::setThreadCount(threadCount);
+}
+
+//! Simule une vague du nombre d'ennemis donné.
+//! \param enemyCount   Nombre d'ennemis.
+//! \param threadCount  Nombre de threads de calcul utilisés.
+//! \return la durée moyenne d'un tick, les réflexions par tick et l'empreinte de l'état
+//! final des ennemis.
+EnemyBenchmark::Measurement EnemyBenchmark::measure(int enemyCount, int threadCount) {
+    RandomStream random(RANDOM_SEED);
+    const QSizeF worldSize(WORLD_WIDTH, WORLD_HEIGHT);
+    const QSizeF enemySize(ENEMY_SIZE, ENEMY_SIZE);
+
+    EnemyStore store;
+    store.setPlayerPosition(QPointF(WORLD_WIDTH / 2.0, WORLD_HEIGHT / 2.0));
+    for (int i = 0; i < enemyCount; ++i) {
+        const EnemyStore::EnemyType type = static_cast<EnemyStore::EnemyType>(i % EnemyStore::ENEMY_TYPE_COUNT);
+        const QPointF position(random.bounded(WORLD_WIDTH - ENEMY_SIZE), random.bounded(WORLD_HEIGHT - ENEMY_SIZE));
+        store.add(type, position, enemySize, random.generate());
+    }
+
+    Measurement measurement = { 0.0, 0.0, 0, 0, 0 };
+    qint64 totalThinkCount = 0;
+    WorkerPool::setThreadCount(threadCount);
+    QElapsedTimer timer;
+    timer.start();
+    for (int tick = 0; tick < TICK_COUNT; ++tick) {
+        store.update(TICK_DURATION, worldSize);
+        store.syncProxies(TICK_DURATION);
+
+        const EnemyStore::ThinkStatistics& rThinks = store.thinkStatistics();
+        totalThinkCount += rThinks.thinkCount;
+        measurement.maxThinkCount = qMax(measurement.maxThinkCount, rThinks.thinkCount);
+        measurement.maxLatency = qMax(measurement.maxLatency, rThinks.maxLatency);
+    }
+    measurement.tickTime = timer.nsecsElapsed() / 1.0e6 / TICK_COUNT;
+    measurement.averageThinkCount = static_cast<double>(totalThinkCount) / TICK_COUNT;
+
+    // Empreinte FNV-1a des positions et orientations : les générateurs des ennemis
+    // déterminent leurs orientations, qui sont donc aussi vérifiées.
+    quint64 hash = 14695981039346656037ull;
+    const auto mix = [&hash](quint64 value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    for (int type = 0; type < EnemyStore::ENEMY_TYPE_COUNT; ++type) {
+        for (int slot = 0; slot < store.count(static_cast<EnemyStore::EnemyType>(type)); ++slot) {
+            const QPointF position = store.position(static_cast<EnemyStore::EnemyType>(type), slot);
+            mix(static_cast<quint64>(qRound64(position.x() * 1024.0)));
+            mix(static_cast<quint64>(qRound64(position.y() * 1024.0)));
+            mix(store.facing(static_cast<EnemyStore::EnemyType>(type), slot));
+        }
+    }
+    measurement.stateHash = hash;
+    return measurement;
+}
@@ -0,0 +1,50 @@
+/**
+  \file
+  \brief    Déclaration de la classe EnemyBenchmark.
+  \date     octobre 2026
+*/
+#ifndef ENEMYBENCHMARK_H
+#define ENEMYBENCHMARK_H
+
+#include <QList>
+#include <QtGlobal>
+
+//! \brief Banc d'essai de la simulation des ennemis (EnemyStore).
+//!
+//! Pour chaque nombre d'ennemis demandé, une vague (un tiers de Leevers, de Leevers
+//! rouges et d'Octopus, à des positions pseudo-aléatoires mais reproductibles) est
+//! simulée pendant quelques secondes de jeu, sans scène ni représentants : seuls les
+//! traitements par lot de EnemyStore sont mesurés.
+//!
+//! Le joueur est placé au centre de la scène : les ennemis éloignés réfléchissent moins
+//! souvent. Le banc d'essai indique le nombre moyen et maximal de réflexions par tick et
+//! leur retard maximal : au-delà du budget de réflexions (EnemyStore::thinkBudget()), le
+//! coût d'un tick ne croît plus avec le nombre d'ennemis, seul le retard augmente.
+//!
+//! Chaque vague est simulée avec un seul thread, puis avec tous les threads de calcul
+//! (WorkerPool) : le banc d'essai indique le gain et vérifie que l'état final des
+//! ennemis (positions et orientations) est identique au bit près.
+//!
+//! Le banc d'essai est lancé par l'option `--bench-enemies` de la ligne de commande.
+//! Les résultats sont écrits dans la sortie de log.
+class EnemyBenchmark
+{
+public:
+    static void run(const QList<int>& rEnemyCounts = QList<int>({ 10, 100, 1000, 10000, 100000 }));
+
+private:
+    EnemyBenchmark() = delete;
+
+    //! Résultats de la simulation d'une vague.
+    struct Measurement {
+        double tickTime;            // Durée moyenne d'un tick (ms).
+        double averageThinkCount;   // Réflexions par tick, en moyenne.
+        int maxThinkCount;          // Réflexions par tick, au maximum.
+        qint64 maxLatency;          // Retard maximal d'une réflexion (ms).
+        quint64 stateHash;          // Empreinte de l'état final des ennemis.
+    };
+
+    static Measurement measure(int enemyCount, int threadCount);
+};
+
+#endif // ENEMYBENCHMARK_H
@@ -0,0 +1,524 @@
+/**
+  \file
+  \brief    Définition de la classe EnemyStore.
+  \date     octobre 2026
+*/
+#include "enemystore.h"
+
+#include "ennemy.h"
+#include "ennemioctopus.h"
+#include "gamerandom.h"
+#include "tracerecorder.h"
+#include "workerpool.h"
+
+namespace {
+
+//! Caractéristiques communes aux ennemis d'un même type.
+struct TypeTraits {
+    int initialHp;
+    int thinkPeriod;            // Temps de jeu (ms) entre deux réflexions, près du joueur.
+    float moveRange;            // Longueur d'un déplacement.
+    GameRandom::Stream aiStream; // Flux d'où sont tirées les graines des ennemis.
+    const char* decideZoneName;  // Zones de la trace (TraceZone) des phases de réflexion.
+    const char* applyZoneName;
+};
+
+const TypeTraits TYPE_TRAITS[EnemyStore::ENEMY_TYPE_COUNT] = {
+    { 1, 3000, 80.0f, GameRandom::LEEVER_AI, "EnnemiLeever::decide", "EnnemiLeever::apply" },
+    { 2, 1500, 120.0f, GameRandom::LEEVER_AI, "EnnemiLeeverRouge::decide", "EnnemiLeeverRouge::apply" },
+    { 1, 100, 0.0f, GameRandom::OCTOPUS_AI, "EnnemiOctopus::decide", "EnnemiOctopus::apply" }
+};
+
+//! Fait avancer le générateur (xorshift32) d'un ennemi et retourne une direction.
+inline quint8 nextFacing(quint32& rState) {
+    quint32 state = rState;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    rState = state;
+    return static_cast<quint8>((static_cast<quint64>(state) * EnemyStore::FACING_COUNT) >> 32);
+}
+
+} // namespace
+
+EnemyStore::EnemyStore() {
+}
+
+//! Ajoute l'ennemi représenté par le sprite donné, à la position et à la taille de
+//! celui-ci. Son générateur est initialisé depuis le flux GameRandom de son type.
+//! \param pProxy  Sprite qui représente l'ennemi dans la scène.
+//! \param type    Type de l'ennemi.
+//! \return l'indice de l'ennemi dans les colonnes de son type.
+int EnemyStore::add(Ennemy* pProxy, EnemyType type) {
+    Q_ASSERT(pProxy->m_pEnemyStore == nullptr);
+    const quint32 randomSeed = GameRandom::stream(TYPE_TRAITS[type].aiStream).generate();
+    const int slot = add(type, pProxy->pos(), QSizeF(pProxy->width(), pProxy->height()), randomSeed);
+    m_columns[type].proxies[slot] = pProxy;
+    pProxy->m_pEnemyStore = this;
+    pProxy->m_enemyType = type;
+    pProxy->m_enemySlot = slot;
+    return slot;
+}
+
+//! Ajoute un ennemi sans représentant.
+//! \param type        Type de l'ennemi.
+//! \param rPosition   Position de l'ennemi.
+//! \param rSize       Taille de l'ennemi, qui le retient dans la scène.
+//! \param randomSeed  Graine du générateur de l'ennemi.
+//! \return l'indice de l'ennemi dans les colonnes de son type.
+int EnemyStore::add(EnemyType type, const QPointF& rPosition, const QSizeF& rSize, quint32 randomSeed) {
+    Columns& rColumns = m_columns[type];
+    rColumns.x.append(static_cast<float>(rPosition.x()));
+    rColumns.y.append(static_cast<float>(rPosition.y()));
+    rColumns.width.append(static_cast<float>(rSize.width()));
+    rColumns.height.append(static_cast<float>(rSize.height()));
+    rColumns.hp.append(static_cast<qint8>(TYPE_TRAITS[type].initialHp));
+    // Les premières réflexions des ennemis d'une même vague sont étalées sur la seconde
+    // moitié de leur délai, plutôt que d'avoir toutes lieu durant le même tick.
+    const int thinkPeriod = TYPE_TRAITS[type].thinkPeriod;
+    rColumns.nextThinkTime.append(m_time + thinkPeriod / 2 + randomSeed % static_cast<quint32>(thinkPeriod / 2 + 1));
+    rColumns.facing.append(FACING_DOWN);
+    // Un état nul bloquerait le générateur.
+    rColumns.randomState.append(randomSeed != 0 ? randomSeed : 0x9E3779B9u);
+    rColumns.isAttacking.append(0);
+    rColumns.proxies.append(nullptr);
+
+    const int slot = rColumns.count() - 1;
+    const quint32 enemyId = allocateId(type, slot);
+    rColumns.ids.append(enemyId);
+    m_scheduler.schedule({ enemyId, m_records.at(enemyId).generation, rColumns.nextThinkTime.at(slot) });
+    return slot;
+}
+
+//! Retire l'ennemi représenté par le sprite donné, s'il fait partie de ce magasin.
+void EnemyStore::remove(Ennemy* pProxy) {
+    if (pProxy->m_pEnemyStore != this)
+        return;
+    remove(static_cast<EnemyType>(pProxy->m_enemyType), pProxy->m_enemySlot);
+}
+
+//! Retire l'ennemi donné : le dernier ennemi de ses colonnes prend sa place.
+//! \param type  Type de l'ennemi.
+//! \param slot  Indice de l'ennemi dans les colonnes de son type.
+void EnemyStore::remove(EnemyType type, int slot) {
+    Columns& rColumns = m_columns[type];
+    Q_ASSERT(slot >= 0 && slot < rColumns.count());
+
+    if (Ennemy* pProxy = rColumns.proxies.at(slot)) {
+        pProxy->m_pEnemyStore = nullptr;
+        pProxy->m_enemySlot = -1;
+    }
+
+    // Sa réflexion programmée sera écartée (voir collectThinks()).
+    const quint32 removedId = rColumns.ids.at(slot);
+    EnemyRecord& rRemovedRecord = m_records[removedId];
+    rRemovedRecord.generation++;
+    rRemovedRecord.slot = -1;
+    m_freeIds.append(removedId);
+
+    const int lastSlot = rColumns.count() - 1;
+    if (type == OCTOPUS && rColumns.isAttacking.at(slot))
+        removeInFlightSlot(slot);
+    if (slot != lastSlot) {
+        rColumns.x[slot] = rColumns.x.at(lastSlot);
+        rColumns.y[slot] = rColumns.y.at(lastSlot);
+        rColumns.width[slot] = rColumns.width.at(lastSlot);
+        rColumns.height[slot] = rColumns.height.at(lastSlot);
+        rColumns.hp[slot] = rColumns.hp.at(lastSlot);
+        rColumns.nextThinkTime[slot] = rColumns.nextThinkTime.at(lastSlot);
+        rColumns.facing[slot] = rColumns.facing.at(lastSlot);
+        rColumns.randomState[slot] = rColumns.randomState.at(lastSlot);
+        rColumns.isAttacking[slot] = rColumns.isAttacking.at(lastSlot);
+        rColumns.proxies[slot] = rColumns.proxies.at(lastSlot);
+        rColumns.ids[slot] = rColumns.ids.at(lastSlot);
+        m_records[rColumns.ids.at(slot)].slot = slot;
+        if (Ennemy* pMovedProxy = rColumns.proxies.at(slot))
+            pMovedProxy->m_enemySlot = slot;
+        if (type == OCTOPUS && rColumns.isAttacking.at(slot)) {
+            const int inFlightIndex = static_cast<int>(m_inFlightSlots.indexOf(lastSlot));
+            if (inFlightIndex >= 0)
+                m_inFlightSlots[inFlightIndex] = slot;
+        }
+    }
+
+    rColumns.x.removeLast();
+    rColumns.y.removeLast();
+    rColumns.width.removeLast();
+    rColumns.height.removeLast();
+    rColumns.hp.removeLast();
+    rColumns.nextThinkTime.removeLast();
+    rColumns.facing.removeLast();
+    rColumns.randomState.removeLast();
+    rColumns.isAttacking.removeLast();
+    rColumns.proxies.removeLast();
+    rColumns.ids.removeLast();
+}
+
+//! Retire tous les ennemis et remet le temps de jeu à zéro.
+//! Les représentants ne sont pas retirés de la scène.
+void EnemyStore::clear() {
+    for (Columns& rColumns : m_columns) {
+        for (Ennemy* pProxy : std::as_const(rColumns.proxies)) {
+            if (pProxy != nullptr) {
+                pProxy->m_pEnemyStore = nullptr;
+                pProxy->m_enemySlot = -1;
+            }
+        }
+        rColumns = Columns();
+    }
+    for (QVector<int>& rMovedSlots : m_movedSlots)
+        rMovedSlots.clear();
+    m_attackingSlots.clear();
+    m_inFlightSlots.clear();
+    m_records.clear();
+    m_freeIds.clear();
+    m_scheduler.clear();
+    m_thinkStatistics = { 0, 0, 0.0, 0 };
+    m_time = 0;
+}
+
+//! \return le nombre d'ennemis, tous types confondus.
+int EnemyStore::count() const {
+    int enemyCount = 0;
+    for (const Columns& rColumns : m_columns)
+        enemyCount += rColumns.count();
+    return enemyCount;
+}
+
+//! \return le nombre d'ennemis du type donné.
+int EnemyStore::count(EnemyType type) const {
+    return m_columns[type].count();
+}
+
+//! \return la position de l'ennemi donné.
+QPointF EnemyStore::position(EnemyType type, int slot) const {
+    return QPointF(m_columns[type].x.at(slot), m_columns[type].y.at(slot));
+}
+
+//! \return les points de vie de l'ennemi donné.
+int EnemyStore::hp(EnemyType type, int slot) const {
+    return m_columns[type].hp.at(slot);
+}
+
+//! Retire un point de vie à l'ennemi donné.
+//! \return les points de vie qui lui restent.
+int EnemyStore::damage(EnemyType type, int slot) {
+    qint8& rHp = m_columns[type].hp[slot];
+    if (rHp > 0)
+        --rHp;
+    return rHp;
+}
+
+//! \return la direction du dernier déplacement ou de la dernière attaque de l'ennemi donné.
+EnemyStore::Facing EnemyStore::facing(EnemyType type, int slot) const {
+    return static_cast<Facing>(m_columns[type].facing.at(slot));
+}
+
+//! Indique si l'ennemi donné a un projectile en vol : un Octopus n'attaque pas tant
+//! que son projectile n'est pas retiré. Les projectiles des Octopus sont déplacés par
+//! syncProxies() tant qu'ils sont en vol.
+void EnemyStore::setAttacking(EnemyType type, int slot, bool isAttacking) {
+    quint8& rIsAttacking = m_columns[type].isAttacking[slot];
+    if (type == OCTOPUS && (rIsAttacking != 0) != isAttacking) {
+        if (isAttacking)
+            m_inFlightSlots.append(slot);
+        else
+            removeInFlightSlot(slot);
+    }
+    rIsAttacking = isAttacking ? 1 : 0;
+}
+
+//! Indique la position du joueur, dont la distance espace les réflexions des ennemis.
+//! Tant qu'elle n'est pas indiquée, tous les ennemis réfléchissent au rythme de leur type.
+void EnemyStore::setPlayerPosition(const QPointF& rPosition) {
+    m_playerPosition = rPosition;
+    m_hasPlayerPosition = true;
+}
+
+//! Change le nombre maximal de réflexions par tick (au moins une).
+void EnemyStore::setThinkBudget(int thinkBudget) {
+    m_thinkBudget = qMax(1, thinkBudget);
+}
+
+//! Fait avancer la simulation des ennemis : phase de décision (éventuellement répartie
+//! entre les threads de calcul), puis phase d'application. Seules les colonnes sont
+//! modifiées : syncProxies() reporte ensuite les changements sur les représentants.
+//! \param elapsedTimeInMilliseconds  Temps de jeu écoulé depuis le tick précédent.
+//! \param rWorldSize                 Taille de la scène, dont les ennemis ne sortent pas.
+void EnemyStore::update(long long elapsedTimeInMilliseconds, const QSizeF& rWorldSize) {
+    m_time += elapsedTimeInMilliseconds;
+    const float worldExtent = static_cast<float>(qMax(rWorldSize.width(), rWorldSize.height()));
+    m_nearDistanceSquared = NEAR_DISTANCE_RATIO * NEAR_DISTANCE_RATIO * worldExtent * worldExtent;
+    m_farDistanceSquared = FAR_DISTANCE_RATIO * FAR_DISTANCE_RATIO * worldExtent * worldExtent;
+    collectThinks();
+    buildChunks();
+
+    {
+        TraceZone zone("EnemyStore::decide");
+        // Chaque tranche n'écrit que dans sa propre liste d'intentions.
+        QVector<Intent>* pChunkIntents = m_chunkIntents.data();
+        const auto decideChunk = [this, &rWorldSize, pChunkIntents](int chunkIndex) {
+            decide(m_chunks.at(chunkIndex), rWorldSize, pChunkIntents[chunkIndex]);
+        };
+        if (m_thinkStatistics.thinkCount >= PARALLEL_THRESHOLD) {
+            WorkerPool::run(static_cast<int>(m_chunks.count()), decideChunk);
+        } else {
+            for (int chunkIndex = 0; chunkIndex < m_chunks.count(); ++chunkIndex)
+                decideChunk(chunkIndex);
+        }
+    }
+
+    apply();
+}
+
+//! Reporte sur les représentants les changements du dernier update() : les ennemis
+//! déplacés sont repositionnés, les projectiles en vol des Octopus sont déplacés, puis
+//! les Octopus qui ont choisi une direction lancent leur projectile.
+//! \param elapsedTimeInMilliseconds  Temps de jeu écoulé depuis le tick précédent.
+void EnemyStore::syncProxies(long long elapsedTimeInMilliseconds) {
+    TraceZone zone("EnemyStore::syncProxies");
+
+    for (int type = 0; type < ENEMY_TYPE_COUNT; ++type) {
+        const Columns& rColumns = m_columns[type];
+        for (int slot : std::as_const(m_movedSlots[type])) {
+            if (Ennemy* pProxy = rColumns.proxies.at(slot))
+                pProxy->setPos(rColumns.x.at(slot), rColumns.y.at(slot));
+        }
+        m_movedSlots[type].clear();
+    }
+
+    // Les projectiles déjà en vol avancent avant que de nouveaux soient lancés, comme
+    // lorsque chaque Octopus avançait son projectile ou attaquait à son tour.
+    // Un projectile retiré ne fait que remettre isAttacking à zéro et retirer son Octopus
+    // de la liste : la copie parcourue et les colonnes ne changent pas pendant ces boucles.
+    Columns& rOctopuses = m_columns[OCTOPUS];
+    m_inFlightScratch = m_inFlightSlots;
+    for (int slot : std::as_const(m_inFlightScratch)) {
+        if (rOctopuses.isAttacking.at(slot) && rOctopuses.proxies.at(slot) != nullptr)
+            static_cast<EnnemiOctopus*>(rOctopuses.proxies.at(slot))->tickProjectile(elapsedTimeInMilliseconds);
+    }
+    for (int slot : std::as_const(m_attackingSlots)) {
+        if (Ennemy* pProxy = rOctopuses.proxies.at(slot))
+            static_cast<EnnemiOctopus*>(pProxy)->attack(static_cast<Facing>(rOctopuses.facing.at(slot)));
+    }
+    m_attackingSlots.clear();
+}
+
+//! \return les points de vie d'un ennemi du type donné à son arrivée.
+int EnemyStore::initialHp(EnemyType type) {
+    return TYPE_TRAITS[type].initialHp;
+}
+
+//! Attribue un identifiant à l'ennemi donné, en réutilisant si possible celui d'un
+//! ennemi retiré.
+quint32 EnemyStore::allocateId(EnemyType type, int slot) {
+    if (m_freeIds.isEmpty()) {
+        m_records.append(EnemyRecord { 0, type, slot });
+        return static_cast<quint32>(m_records.count() - 1);
+    }
+
+    const quint32 enemyId = m_freeIds.takeLast();
+    m_records[enemyId].type = type;
+    m_records[enemyId].slot = slot;
+    return enemyId;
+}
+
+//! Retire de l'échéancier les réflexions dues de ce tick, dans la limite de thinkBudget(),
+//! et range les ennemis concernés par type. Les réflexions des ennemis retirés depuis
+//! leur programmation sont écartées sans compter dans le budget.
+void EnemyStore::collectThinks() {
+    for (QVector<int>& rThinkSlots : m_thinkSlots)
+        rThinkSlots.resize(0);
+    m_scheduler.advance(m_time);
+
+    int thinkCount = 0;
+    qint64 totalLatency = 0;
+    qint64 maxLatency = 0;
+    ThinkScheduler::Entry entry;
+    while (thinkCount < m_thinkBudget && m_scheduler.takeDue(entry)) {
+        const EnemyRecord& rRecord = m_records.at(entry.enemyId);
+        if (rRecord.slot < 0 || rRecord.generation != entry.generation)
+            continue;
+        m_thinkSlots[rRecord.type].append(rRecord.slot);
+        const qint64 latency = m_time - entry.thinkTime;
+        totalLatency += latency;
+        maxLatency = qMax(maxLatency, latency);
+        thinkCount++;
+    }
+
+    m_thinkStatistics.thinkCount = thinkCount;
+    m_thinkStatistics.pendingCount = m_scheduler.dueCount();
+    m_thinkStatistics.averageLatency = thinkCount > 0 ? static_cast<double>(totalLatency) / thinkCount : 0.0;
+    m_thinkStatistics.maxLatency = maxLatency;
+}
+
+//! \return le facteur appliqué au délai entre deux réflexions d'un ennemi dont le centre
+//! est donné : 1 près du joueur, 2 au-delà de NEAR_DISTANCE_RATIO et 4 au-delà de
+//! FAR_DISTANCE_RATIO fois le plus grand côté de la scène.
+float EnemyStore::thinkPeriodFactor(float centerX, float centerY) const {
+    if (!m_hasPlayerPosition)
+        return 1.0f;
+
+    const float dx = centerX - static_cast<float>(m_playerPosition.x());
+    const float dy = centerY - static_cast<float>(m_playerPosition.y());
+    const float squaredDistance = dx * dx + dy * dy;
+    if (squaredDistance > m_farDistanceSquared)
+        return 4.0f;
+    if (squaredDistance > m_nearDistanceSquared)
+        return 2.0f;
+    return 1.0f;
+}
+
+//! Retire l'Octopus donné de la liste des projectiles en vol, sans changer l'ordre des
+//! autres.
+void EnemyStore::removeInFlightSlot(int slot) {
+    const int inFlightIndex = static_cast<int>(m_inFlightSlots.indexOf(slot));
+    if (inFlightIndex >= 0)
+        m_inFlightSlots.remove(inFlightIndex);
+}
+
+//! Découpe les réflexions de chaque type en tranches d'au plus CHUNK_SIZE ennemis.
+void EnemyStore::buildChunks() {
+    m_chunks.clear();
+    for (int type = 0; type < ENEMY_TYPE_COUNT; ++type) {
+        const int thinkCount = static_cast<int>(m_thinkSlots[type].count());
+        for (int begin = 0; begin < thinkCount; begin += CHUNK_SIZE)
+            m_chunks.append(Chunk { static_cast<EnemyType>(type), begin, qMin(begin + CHUNK_SIZE, thinkCount) });
+    }
+    if (m_chunkIntents.count() < m_chunks.count())
+        m_chunkIntents.resize(m_chunks.count());
+}
+
+//! Phase de décision d'une tranche : lit les colonnes, sans les modifier, et écrit les
+//! intentions de ses ennemis. Peut être appelée depuis n'importe quel thread : la zone de
+//! trace de la tranche, nommée d'après le type de ses ennemis, figure sur la ligne de
+//! temps du thread qui l'a traitée.
+void EnemyStore::decide(const Chunk& rChunk, const QSizeF& rWorldSize, QVector<Intent>& rIntents) const {
+    TraceZone zone(TYPE_TRAITS[rChunk.type].decideZoneName);
+    rIntents.resize(0);
+    if (rChunk.type == OCTOPUS)
+        decideOctopuses(rChunk, rIntents);
+    else
+        decideLeevers(rChunk, rWorldSize, rIntents);
+}
+
+//! Décision des Leevers (ou des Leevers rouges) : chaque ennemi tire une direction et
+//! décide de s'y déplacer d'un pas, à moins que ce pas ne le fasse sortir de la scène.
+void EnemyStore::decideLeevers(const Chunk& rChunk, const QSizeF& rWorldSize, QVector<Intent>& rIntents) const {
+    const Columns& rColumns = m_columns[rChunk.type];
+    const TypeTraits& rTraits = TYPE_TRAITS[rChunk.type];
+    const float range = rTraits.moveRange;
+    const float worldWidth = static_cast<float>(rWorldSize.width());
+    const float worldHeight = static_cast<float>(rWorldSize.height());
+    const qint64 time = m_time;
+
+    const int* pThinkSlots = m_thinkSlots[rChunk.type].constData();
+    const float* pX = rColumns.x.constData();
+    const float* pY = rColumns.y.constData();
+    const float* pWidth = rColumns.width.constData();
+    const float* pHeight = rColumns.height.constData();
+    const quint32* pRandomState = rColumns.randomState.constData();
+
+    for (int thinkIndex = rChunk.begin; thinkIndex < rChunk.end; ++thinkIndex) {
+        const int i = pThinkSlots[thinkIndex];
+        const float periodFactor = thinkPeriodFactor(pX[i] + pWidth[i] / 2.0f, pY[i] + pHeight[i] / 2.0f);
+        const qint64 nextThinkTime = time + static_cast<qint64>(rTraits.thinkPeriod * periodFactor);
+
+        Intent intent = { i, pX[i], pY[i], nextThinkTime, pRandomState[i], 0, Intent::WAIT };
+        intent.facing = nextFacing(intent.randomState);
+        switch (intent.facing) {
+        case FACING_UP:
+            if (pY[i] - range >= 0.0f) {
+                intent.y -= range;
+                intent.action = Intent::MOVE;
+            }
+            break;
+        case FACING_DOWN:
+            if (pY[i] + range <= worldHeight - pHeight[i]) {
+                intent.y += range;
+                intent.action = Intent::MOVE;
+            }
+            break;
+        case FACING_LEFT:
+            if (pX[i] - range >= 0.0f) {
+                intent.x -= range;
+                intent.action = Intent::MOVE;
+            }
+            break;
+        case FACING_RIGHT:
+            if (pX[i] + range <= worldWidth - pWidth[i]) {
+                intent.x += range;
+                intent.action = Intent::MOVE;
+            }
+            break;
+        }
+        rIntents.append(intent);
+    }
+}
+
+//! Décision des Octopus : un Octopus sans projectile en vol tire la direction de sa
+//! prochaine attaque ; les autres attendent leur prochaine réflexion.
+void EnemyStore::decideOctopuses(const Chunk& rChunk, QVector<Intent>& rIntents) const {
+    const Columns& rColumns = m_columns[OCTOPUS];
+    const TypeTraits& rTraits = TYPE_TRAITS[OCTOPUS];
+    const qint64 time = m_time;
+
+    const int* pThinkSlots = m_thinkSlots[OCTOPUS].constData();
+    const float* pX = rColumns.x.constData();
+    const float* pY = rColumns.y.constData();
+    const float* pWidth = rColumns.width.constData();
+    const float* pHeight = rColumns.height.constData();
+    const quint8* pIsAttacking = rColumns.isAttacking.constData();
+    const quint8* pFacing = rColumns.facing.constData();
+    const quint32* pRandomState = rColumns.randomState.constData();
+
+    for (int thinkIndex = rChunk.begin; thinkIndex < rChunk.end; ++thinkIndex) {
+        const int i = pThinkSlots[thinkIndex];
+        const float periodFactor = thinkPeriodFactor(pX[i] + pWidth[i] / 2.0f, pY[i] + pHeight[i] / 2.0f);
+        const qint64 nextThinkTime = time + static_cast<qint64>(rTraits.thinkPeriod * periodFactor);
+
+        Intent intent = { i, pX[i], pY[i], nextThinkTime, pRandomState[i], pFacing[i], Intent::WAIT };
+        if (!pIsAttacking[i]) {
+            intent.facing = nextFacing(intent.randomState);
+            intent.action = Intent::ATTACK;
+        }
+        rIntents.append(intent);
+    }
+}
+
+//! Phase d'application, depuis le thread du jeu : applique les intentions aux colonnes,
+//! tranche après tranche, programme la prochaine réflexion de chaque ennemi et note les
+//! ennemis à reporter sur leur représentant.
+void EnemyStore::apply() {
+    TraceZone zone("EnemyStore::apply");
+
+    // Les tranches sont rangées par type : chaque type a sa propre zone de trace.
+    int chunkIndex = 0;
+    while (chunkIndex < m_chunks.count()) {
+        const EnemyType type = m_chunks.at(chunkIndex).type;
+        TraceZone typeZone(TYPE_TRAITS[type].applyZoneName);
+        Columns& rColumns = m_columns[type];
+        for (; chunkIndex < m_chunks.count() && m_chunks.at(chunkIndex).type == type; ++chunkIndex) {
+            for (const Intent& rIntent : std::as_const(m_chunkIntents.at(chunkIndex))) {
+                const int slot = rIntent.slot;
+                rColumns.nextThinkTime[slot] = rIntent.nextThinkTime;
+                rColumns.randomState[slot] = rIntent.randomState;
+                rColumns.facing[slot] = rIntent.facing;
+                const quint32 enemyId = rColumns.ids.at(slot);
+                m_scheduler.schedule({ enemyId, m_records.at(enemyId).generation, rIntent.nextThinkTime });
+                switch (rIntent.action) {
+                case Intent::WAIT:
+                    break;
+                case Intent::MOVE:
+                    rColumns.x[slot] = rIntent.x;
+                    rColumns.y[slot] = rIntent.y;
+                    m_movedSlots[type].append(slot);
+                    break;
+                case Intent::ATTACK:
+                    m_attackingSlots.append(slot);
+                    break;
+                }
+            }
+        }
+    }
+}
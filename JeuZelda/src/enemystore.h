@@ -0,0 +1,234 @@
+/**
+  \file
+  \brief    Déclaration de la classe EnemyStore.
+  \date     octobre 2026
+*/
+#ifndef ENEMYSTORE_H
+#define ENEMYSTORE_H
+
+#include <QPointF>
+#include <QSizeF>
+#include <QVector>
+#include <QtGlobal>
+
+#include "thinkscheduler.h"
+
+class Ennemy;
+
+//! \brief Simulation des ennemis d'une partie, rangée en colonnes contiguës.
+//!
+//! L'état simulé des ennemis (position, taille, points de vie, prochain déplacement,
+//! orientation et générateur pseudo-aléatoire) n'est plus réparti entre les objets
+//! Ennemy : il est rangé dans des tableaux contigus, un par champ (« structure de
+//! tableaux »). Chaque type d'ennemi (EnemyType) a ses propres colonnes, si bien que
+//! le type d'un ennemi est donné par les colonnes qui le contiennent.
+//!
+//! À chaque tick, update() fait avancer le temps de jeu puis fait « réfléchir » les
+//! ennemis dont l'heure de réflexion est arrivée, selon le traitement par lot de leur
+//! type :
+//!
+//! - Leevers et Leevers rouges : chaque ennemi tire une direction et s'y déplace d'un
+//!   pas, s'il reste dans la scène ;
+//! - Octopus : un Octopus sans projectile en vol tire une direction d'attaque.
+//!
+//! Chaque ennemi a sa propre heure de réflexion, programmée dans un échéancier
+//! (ThinkScheduler) : un tick ne coûte que les réflexions dues, et non un passage sur
+//! tous les ennemis. Au plus thinkBudget() réflexions ont lieu par tick ; les suivantes
+//! attendent, dans l'ordre, le tick suivant. Le délai entre deux réflexions dépend du
+//! type de l'ennemi et de sa distance au joueur (setPlayerPosition()) : il est doublé
+//! au-delà de NEAR_DISTANCE_RATIO et quadruplé au-delà de FAR_DISTANCE_RATIO fois le
+//! plus grand côté de la scène (320 et 640 pixels dans la scène de 1280 x 720 pixels
+//! du jeu). thinkStatistics()
+//! indique le nombre de réflexions du dernier tick et leur retard sur leur heure.
+//!
+//! La réflexion se fait en deux phases :
+//!
+//! - décision : les réflexions dues sont découpées en tranches de CHUNK_SIZE ennemis ;
+//!   chaque tranche ne fait que lire les colonnes et écrit les intentions de ses ennemis
+//!   (Intent : déplacement, attaque, nouvel état du générateur, prochaine réflexion)
+//!   dans sa propre liste. À partir de PARALLEL_THRESHOLD réflexions, les tranches sont
+//!   réparties entre les threads de calcul (WorkerPool) ;
+//! - application : depuis le thread du jeu, les intentions sont appliquées aux colonnes,
+//!   tranche après tranche, et les prochaines réflexions sont programmées dans le même
+//!   ordre.
+//!
+//! Comme la décision d'un ennemi ne dépend que de son propre état, et que l'application
+//! suit toujours le même ordre, le résultat est identique au bit près quel que soit le
+//! nombre de threads : une partie rejouée avec la même graine se déroule à l'identique.
+//!
+//! Ces traitements ne touchent qu'aux colonnes et notent les ennemis déplacés ou qui
+//! attaquent. syncProxies() reporte ensuite ces changements, une seule fois par tick,
+//! sur les sprites (Ennemy) qui représentent les ennemis dans la scène : ceux-ci ne
+//! sont plus que des représentants chargés de l'affichage et des collisions.
+//! Un Octopus qui attaque lance son projectile (EnnemiOctopus::attack()) et ses
+//! projectiles en vol sont déplacés à ce moment. Les Octopus qui ont un projectile en
+//! vol (setAttacking()) sont tenus dans une liste, dans l'ordre de leurs lancers : seuls
+//! ceux-ci sont parcourus, et non tous les Octopus.
+//!
+//! Chaque ennemi tire ses directions de son propre générateur, initialisé à son
+//! arrivée depuis le flux de GameRandom de son type : la partie reste reproductible
+//! quel que soit l'ordre des ennemis dans les colonnes.
+//!
+//! Un ennemi est retiré en O(1) : le dernier ennemi de ses colonnes prend sa place.
+//! Un ennemi peut être ajouté sans représentant (le banc d'essai EnemyBenchmark
+//! simule ainsi des vagues de milliers d'ennemis sans scène).
+class EnemyStore
+{
+public:
+    enum EnemyType {
+        LEEVER,
+        RED_LEEVER,
+        OCTOPUS,
+        ENEMY_TYPE_COUNT
+    };
+
+    //! Nombre d'ennemis d'une tranche de la phase de décision.
+    static constexpr int CHUNK_SIZE = 1024;
+    //! Nombre de réflexions à partir duquel la phase de décision est répartie entre les threads.
+    static constexpr int PARALLEL_THRESHOLD = 4096;
+    //! Nombre maximal de réflexions par tick, par défaut.
+    static constexpr int DEFAULT_THINK_BUDGET = 8192;
+    //! Distances au joueur au-delà desquelles un ennemi réfléchit deux, puis quatre fois
+    //! moins souvent, en proportion du plus grand côté de la scène.
+    static constexpr float NEAR_DISTANCE_RATIO = 0.25f;
+    static constexpr float FAR_DISTANCE_RATIO = 0.5f;
+
+    enum Facing {
+        FACING_UP,
+        FACING_DOWN,
+        FACING_LEFT,
+        FACING_RIGHT,
+        FACING_COUNT
+    };
+
+    //! Réflexions du dernier tick (voir update()).
+    struct ThinkStatistics {
+        int thinkCount;             //!< Réflexions effectuées.
+        int pendingCount;           //!< Réflexions dues, reportées au tick suivant.
+        double averageLatency;      //!< Retard moyen des réflexions sur leur heure (ms).
+        qint64 maxLatency;          //!< Retard maximal (ms).
+    };
+
+    EnemyStore();
+
+    int add(Ennemy* pProxy, EnemyType type);
+    int add(EnemyType type, const QPointF& rPosition, const QSizeF& rSize, quint32 randomSeed);
+    void remove(Ennemy* pProxy);
+    void remove(EnemyType type, int slot);
+    void clear();
+
+    int count() const;
+    int count(EnemyType type) const;
+
+    QPointF position(EnemyType type, int slot) const;
+    int hp(EnemyType type, int slot) const;
+    int damage(EnemyType type, int slot);
+    Facing facing(EnemyType type, int slot) const;
+    void setAttacking(EnemyType type, int slot, bool isAttacking);
+
+    void setPlayerPosition(const QPointF& rPosition);
+    int thinkBudget() const { return m_thinkBudget; }
+    void setThinkBudget(int thinkBudget);
+    const ThinkStatistics& thinkStatistics() const { return m_thinkStatistics; }
+
+    void update(long long elapsedTimeInMilliseconds, const QSizeF& rWorldSize);
+    void syncProxies(long long elapsedTimeInMilliseconds);
+
+    static int initialHp(EnemyType type);
+
+private:
+    //! Colonnes des ennemis d'un même type : l'ennemi d'indice i occupe la case i de
+    //! chaque colonne.
+    struct Columns {
+        QVector<float> x;
+        QVector<float> y;
+        QVector<float> width;
+        QVector<float> height;
+        QVector<qint8> hp;
+        QVector<qint64> nextThinkTime;
+        QVector<quint8> facing;
+        QVector<quint32> randomState;
+        QVector<quint8> isAttacking;
+        QVector<Ennemy*> proxies;
+        QVector<quint32> ids;
+
+        int count() const { return static_cast<int>(x.count()); }
+    };
+
+    //! Intention d'un ennemi, décidée à partir de son état et appliquée ensuite.
+    struct Intent {
+        enum Action : quint8 {
+            WAIT,       //!< Seuls le générateur et l'heure de réflexion changent.
+            MOVE,       //!< L'ennemi se déplace en (x, y).
+            ATTACK      //!< L'ennemi attaque dans la direction facing.
+        };
+
+        int slot;
+        float x;
+        float y;
+        qint64 nextThinkTime;
+        quint32 randomState;
+        quint8 facing;
+        Action action;
+    };
+
+    //! Tranche de la phase de décision : réflexions [begin, end[ d'un type.
+    struct Chunk {
+        EnemyType type;
+        int begin;
+        int end;
+    };
+
+    //! Identifiant d'un ennemi : sa place dans les colonnes change lorsqu'un autre est
+    //! retiré, mais son identifiant reste le même. La génération distingue les ennemis
+    //! successifs d'un même identifiant.
+    struct EnemyRecord {
+        quint32 generation;
+        EnemyType type;
+        int slot;               //!< -1 si l'identifiant est libre.
+    };
+
+    quint32 allocateId(EnemyType type, int slot);
+    void collectThinks();
+    float thinkPeriodFactor(float centerX, float centerY) const;
+    void buildChunks();
+    void decide(const Chunk& rChunk, const QSizeF& rWorldSize, QVector<Intent>& rIntents) const;
+    void decideLeevers(const Chunk& rChunk, const QSizeF& rWorldSize, QVector<Intent>& rIntents) const;
+    void decideOctopuses(const Chunk& rChunk, QVector<Intent>& rIntents) const;
+    void apply();
+    void removeInFlightSlot(int slot);
+
+    Columns m_columns[ENEMY_TYPE_COUNT];
+    qint64 m_time = 0;
+
+    QVector<EnemyRecord> m_records;
+    QVector<quint32> m_freeIds;
+
+    ThinkScheduler m_scheduler;
+    int m_thinkBudget = DEFAULT_THINK_BUDGET;
+    QPointF m_playerPosition;
+    bool m_hasPlayerPosition = false;
+    // Carrés des distances de NEAR_DISTANCE_RATIO et FAR_DISTANCE_RATIO dans la scène du
+    // dernier update().
+    float m_nearDistanceSquared = 0.0f;
+    float m_farDistanceSquared = 0.0f;
+    ThinkStatistics m_thinkStatistics = { 0, 0, 0.0, 0 };
+    // Ennemis qui réfléchissent durant ce tick, par type.
+    QVector<int> m_thinkSlots[ENEMY_TYPE_COUNT];
+
+    // Tranches du dernier update() et leurs intentions (une liste par tranche, dont la
+    // capacité est conservée d'un tick à l'autre).
+    QVector<Chunk> m_chunks;
+    QVector<QVector<Intent>> m_chunkIntents;
+
+    // Ennemis modifiés par le dernier update(), à reporter sur leur représentant.
+    QVector<int> m_movedSlots[ENEMY_TYPE_COUNT];
+    QVector<int> m_attackingSlots;
+
+    // Octopus qui ont un projectile en vol, dans l'ordre de leurs lancers, et copie de
+    // cette liste parcourue par syncProxies().
+    QVector<int> m_inFlightSlots;
+    QVector<int> m_inFlightScratch;
+};
+
+#endif // ENEMYSTORE_H
@@ -6,15 +6,20 @@
 #include "utilities.h"
 #include "sprite.h"
 #include "gamescene.h"
+#include "enemystore.h"
 #include "ennemy.h"
 #include "ennemileever.h"
 #include "ennemileeverrouge.h"
 #include "ennemioctopus.h"
+#include "gamepools.h"
+#include "gamerandom.h"
 
-EnnemiFactory::EnnemiFactory(GameScene* scene, Player* player)
+EnnemiFactory::EnnemiFactory(GameScene* scene, Player* player, EnemyStore* pEnemyStore, BulletEngine* pBulletEngine)
 {
     m_pScene = scene;
     m_pPlayer = player;
+    m_pEnemyStore = pEnemyStore;
+    m_pBulletEngine = pBulletEngine;
 }
 
 //! \param ennemi L'ennemi à positionner
@@ -24,21 +29,25 @@ EnnemiFactory::EnnemiFactory(GameScene* scene, Player* player)
 //! \param sceneHeight La hauteur de la scène
 //! Positionne un ennemi de manière aléatoire avec une marge de 100px par rapport au joueur
 void EnnemiFactory::randomlyPositionEnemyWithMargin(Ennemy* ennemi, qreal playerPosX, qreal playerPosY, qreal sceneWidth, qreal sceneHeight) {
-    ennemi->setX(QRandomGenerator::global()->bounded(sceneWidth - ennemi->width()));
-    ennemi->setY(QRandomGenerator::global()->bounded(sceneHeight - ennemi->height() - 100) + 50);
+    ennemi->setX(GameRandom::stream(GameRandom::SPAWN).bounded(sceneWidth - ennemi->width()));
+    ennemi->setY(GameRandom::stream(GameRandom::SPAWN).bounded(sceneHeight - ennemi->height() - 100) + 50);
 
     while (qAbs(ennemi->x() - playerPosX) < 100 || qAbs(ennemi->y() - playerPosY) < 100) {
         // Réessayer si la distance minimale entre le joueur et l'ennemi n'est pas respectée
-        ennemi->setX(QRandomGenerator::global()->bounded(sceneWidth - ennemi->width()));
-        ennemi->setY(QRandomGenerator::global()->bounded(sceneHeight - ennemi->height() - 100) + 50);
+        ennemi->setX(GameRandom::stream(GameRandom::SPAWN).bounded(sceneWidth - ennemi->width()));
+        ennemi->setY(GameRandom::stream(GameRandom::SPAWN).bounded(sceneHeight - ennemi->height() - 100) + 50);
     }
 }
 
 //! Crée une vague d'ennemis
+//! Les ennemis sont obtenus de leur réservoir (GamePools) : ceux des vagues précédentes sont recyclés.
+//! Une fois positionnés, ils sont ajoutés au magasin (EnemyStore) qui les simule.
 //! \param nbreEnnemiLeever Le nombre d'ennemis Leever à générer
 //! \param nbreEnnemiLeeverRouge Le nombre d'ennemis Leever Rouge à générer
 //! \param nbreEnnemiOctopus Le nombre d'ennemis Octopus à générer
-void EnnemiFactory::createWave(int nbreEnnemiLeever, int nbreEnnemiLeeverRouge, int nbreEnnemiOctopus) {
+//! \param octopusPatternId La salve des Octopus (BulletPatterns::PatternId), ou BulletPatterns::NO_PATTERN
+//! s'ils lancent un seul rocher
+void EnnemiFactory::createWave(int nbreEnnemiLeever, int nbreEnnemiLeeverRouge, int nbreEnnemiOctopus, int octopusPatternId) {
     qreal playerPosX = m_pPlayer->x();
     qreal playerPosY = m_pPlayer->y();
     qreal sceneWidth = m_pScene->width();
@@ -46,23 +55,27 @@ void EnnemiFactory::createWave(int nbreEnnemiLeever, int nbreEnnemiLeeverRouge,
 
     // Génère le nombre d'ennemis Leever demandés
     for (int i = 0; i < nbreEnnemiLeever; i++) {
-        EnnemiLeever* ennemi = new EnnemiLeever();
+        EnnemiLeever* ennemi = GamePools::leevers().acquire();
         m_pScene->addSpriteToScene(ennemi);
         randomlyPositionEnemyWithMargin(ennemi, playerPosX, playerPosY, sceneWidth, sceneHeight);
+        m_pEnemyStore->add(ennemi, EnemyStore::LEEVER);
     }
 
     // Génère le nombre d'ennemis LeeverRouge demandés
     for (int i = 0; i < nbreEnnemiLeeverRouge; i++) {
-        EnnemiLeeverRouge* ennemi = new EnnemiLeeverRouge();
+        EnnemiLeeverRouge* ennemi = GamePools::redLeevers().acquire();
         m_pScene->addSpriteToScene(ennemi);
         randomlyPositionEnemyWithMargin(ennemi, playerPosX, playerPosY, sceneWidth, sceneHeight);
+        m_pEnemyStore->add(ennemi, EnemyStore::RED_LEEVER);
     }
 
     // Génère le nombre d'ennemis Octopus demandés
     for (int i = 0; i < nbreEnnemiOctopus; i++) {
-        EnnemiOctopus* ennemi = new EnnemiOctopus();
+        EnnemiOctopus* ennemi = GamePools::octopuses().acquire();
+        ennemi->setBulletEmitter(m_pBulletEngine, octopusPatternId);
         m_pScene->addSpriteToScene(ennemi);
         randomlyPositionEnemyWithMargin(ennemi, playerPosX, playerPosY, sceneWidth, sceneHeight);
+        m_pEnemyStore->add(ennemi, EnemyStore::OCTOPUS);
     }
 }
 
@@ -11,16 +11,21 @@ class GameScene;
 class Player;
 class Ennemy;
 class GameCore;
+class EnemyStore;
+class BulletEngine;
 
 class EnnemiFactory
 {
 public:
-    EnnemiFactory(GameScene* scene, Player* player);
+    EnnemiFactory(GameScene* scene, Player* player, EnemyStore* pEnemyStore, BulletEngine* pBulletEngine);
     void randomlyPositionEnemyWithMargin(Ennemy* ennemi, qreal playerPosX, qreal playerPosY, qreal sceneWidth, qreal sceneHeight);
-    void createWave(int nbreEnnemiLeever, int nbreEnnemiLeeverRouge, int nbreEnnemiOctopus);
+    void createWave(int nbreEnnemiLeever, int nbreEnnemiLeeverRouge, int nbreEnnemiOctopus,
+                    int octopusPatternId = -1);
 
     GameScene* m_pScene = nullptr;
     Player* m_pPlayer = nullptr;
+    EnemyStore* m_pEnemyStore = nullptr;
+    BulletEngine* m_pBulletEngine = nullptr;
 };
 
 #endif // ENNEMIFACTORY_H
@@ -3,76 +3,114 @@
 #include "utilities.h"
 #include "gamecore.h"
 #include "gamescene.h"
-#include <cstdlib>
-#include <QRandomGenerator>
+#include "gamepools.h"
+#include "gameclips.h"
+#include "bulletengine.h"
+#include "timerwheel.h"
+#include <cmath>
 
-EnnemiOctopus::EnnemiOctopus(): Ennemy(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_1.gif")
+EnnemiOctopus::EnnemiOctopus(): Ennemy(GameClips::clip(GameClips::OCTOPUS))
 {
-    // Animation de l'ennemi
-    addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_1.gif");
-    addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_2.gif");
-    startAnimation(100);
+    // Animation de l'ennemi, partagée par tous les Octopus
+    startAnimation();
     // offset au millieu du sprite
     setOffset(sceneBoundingRect().width() / -2.0, sceneBoundingRect().height() / -2.0);
     setScale(OCTOPUS_SCALE_FACTOR);
-    m_Hp = 1;
 }
 
-void EnnemiOctopus::tick(long long elapsedTimeInMilliseconds) {
-    // L'ennemi attaque le joueur avec un projectile
-    if(m_pProjectil != nullptr) {
-        m_pProjectil->tick(elapsedTimeInMilliseconds);
-    } else {
-        // Génére un nombre aléatoire entre 0 et 2 inclus
-        int randomDirection = QRandomGenerator::global()->bounded(0, 4);
-        switch (randomDirection) {
-        case 0:
-            // Attaque vers le haut
-            attack(QPointF(0, -1));
-            setRotation(180);
-            break;
-        case 1:
-            // Attaque vers le bas
-            attack(QPointF(0, 1));
-            setRotation(0);
-            break;
-        case 2:
-            // Attaque vers la gauche
-            attack(QPointF(-1, 0));
-            setRotation(90);
-            break;
-        case 3:
-            // Attaque vers la droite
-            attack(QPointF(1, 0));
-            setRotation(270);
-            break;
-        }
-    }
+//! Remet l'ennemi dans son état initial, lorsqu'il est obtenu de son réservoir.
+void EnnemiOctopus::reset() {
+    Ennemy::reset();
+    // La salve est donnée par EnnemiFactory à chaque vague.
+    m_bulletEmitter = BulletEmitter();
+    startAnimation();
+}
+
+//! Rend l'ennemi à son réservoir, ce qui le retire de la scène avec son projectile.
+void EnnemiOctopus::releaseToPool() {
+    GamePools::octopuses().release(this);
 }
 
+//! Donne à l'ennemi la salve qu'il tire, à la place d'un seul rocher.
+//! \param pBulletEngine  Moteur de projectiles qui simule les salves.
+//! \param patternId      Salve (BulletPatterns::PatternId), ou BulletPatterns::NO_PATTERN.
+void EnnemiOctopus::setBulletEmitter(BulletEngine* pBulletEngine, int patternId) {
+    m_pBulletEngine = pBulletEngine;
+    m_bulletEmitter = BulletEmitter();
+    m_bulletEmitter.patternId = patternId;
+}
+
+//! Lance un projectile dans la direction donnée, choisie par EnemyStore, et tourne
+//! l'ennemi vers elle. Si l'ennemi a une salve, elle est tirée par le moteur de
+//! projectiles, et l'ennemi attend la cadence de sa salve avant d'attaquer de nouveau.
+//! \param facing  Direction de l'attaque.
+void EnnemiOctopus::attack(EnemyStore::Facing facing) {
+    if(m_pProjectil != nullptr)
+        return;
+    QPointF direction;
+    switch (facing) {
+    case EnemyStore::FACING_UP:
+        // Attaque vers le haut
+        direction = QPointF(0, -1);
+        setRotation(180);
+        break;
+    case EnemyStore::FACING_DOWN:
+        // Attaque vers le bas
+        direction = QPointF(0, 1);
+        setRotation(0);
+        break;
+    case EnemyStore::FACING_LEFT:
+        // Attaque vers la gauche
+        direction = QPointF(-1, 0);
+        setRotation(90);
+        break;
+    case EnemyStore::FACING_RIGHT:
+    case EnemyStore::FACING_COUNT:
+        // Attaque vers la droite
+        direction = QPointF(1, 0);
+        setRotation(270);
+        break;
+    }
 
-void EnnemiOctopus::attack(QPointF direction) {
-    if(m_pProjectil = nullptr)
+    if (m_pBulletEngine != nullptr && m_bulletEmitter.patternId != BulletPatterns::NO_PATTERN) {
+        const qreal facingAngle = std::atan2(direction.y(), direction.x()) * 180.0 / M_PI;
+        m_pBulletEngine->fire(m_bulletEmitter, pos(), facingAngle);
+        const BulletPattern& rPattern = BulletPatterns::pattern(static_cast<BulletPatterns::PatternId>(m_bulletEmitter.patternId));
+        // Le minuteur est annulé si l'ennemi quitte la scène entre-temps.
+        setAttacking(true);
+        parentScene()->timerWheel()->schedule(rPattern.fireInterval, [this]() {
+            setAttacking(false);
+        }, this);
         return;
-    m_pProjectil = new Projectile(350, direction, GameFramework::imagesPath() + "JeuZelda/RockProjectil.png", this);
-    m_pProjectil->setScale(2);
+    }
+
+    m_pProjectil = GamePools::rocks().acquire();
+    m_pProjectil->launch(350, direction, this);
     m_pProjectil->setPos(pos());
     // m_pSword->setOffset(sceneBoundingRect().width() / -2.0, sceneBoundingRect().height() / -2.0);
     parentScene()->addSpriteToScene(m_pProjectil);
+    setAttacking(true);
+}
+
+//! Déplace le projectile en vol de l'ennemi, s'il en a un.
+void EnnemiOctopus::tickProjectile(long long elapsedTimeInMilliseconds) {
+    if(m_pProjectil != nullptr)
+        m_pProjectil->tick(elapsedTimeInMilliseconds);
 }
 
 void EnnemiOctopus::damage() {
-    m_Hp--;
-    if(m_Hp <= 0) {
+    if(loseHp() <= 0) {
         createCloudOnDeath(pos());
         createItemOnDeath(pos(), CHANCE_TO_SPAWN_HEART, CHANCE_TO_SPAWN_BLUE_RING, CHANCE_TO_SPAWN_TRIFORCE);
+        // Le projectile est rendu avec l'ennemi.
         removeEnnemyFromScene();
-        removeProjectile();
     }
 }
 
 void EnnemiOctopus::removeProjectile() {
-    parentScene()->removeSpriteFromScene(m_pProjectil);
-    delete m_pProjectil;
+    if (m_pProjectil == nullptr)
+        return;
+    GamePools::rocks().release(m_pProjectil);
     m_pProjectil = nullptr;
+    setAttacking(false);
 }
@@ -3,19 +3,29 @@
 
 #include "ennemy.h"
 #include "projectile.h"
+#include "bulletpatterns.h"
+
+class BulletEngine;
 
 class EnnemiOctopus : public Ennemy
 {
 public:
     EnnemiOctopus();
 
-    void tick(long long elapsedTimeInMilliseconds) override;
     void damage() override;
-    void attack(QPointF direction);
+    void reset() override;
+    void attack(EnemyStore::Facing facing);
+    void setBulletEmitter(BulletEngine* pBulletEngine, int patternId);
+    void tickProjectile(long long elapsedTimeInMilliseconds);
     void removeProjectile();
 
+protected:
+    void releaseToPool() override;
+
 private:
     Projectile* m_pProjectil = nullptr;
+    BulletEngine* m_pBulletEngine = nullptr;
+    BulletEmitter m_bulletEmitter;
 
     static constexpr int OCTOPUS_SCALE_FACTOR = 3.5;
     static constexpr int CHANCE_TO_SPAWN_HEART = 8;
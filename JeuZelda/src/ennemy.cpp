@@ -3,121 +3,92 @@
 #include "utilities.h"
 #include "gamecore.h"
 #include "gamescene.h"
-#include <QRandomGenerator>
+#include "gamepools.h"
+#include "gamerandom.h"
 
-Ennemy::Ennemy(QString imagePath) : Sprite(imagePath)
+Ennemy::Ennemy(const AnimationClipPointer& rpClip) : Sprite(rpClip)
 {
-    setData(GameCore::SpriteDataKey::SPRITE_TYPE_KEY, GameCore::ENNEMI);
+    setSpriteType(GameCore::ENNEMI);
+}
+
+//! Retire l'ennemi du magasin qui le simule, s'il en fait encore partie.
+Ennemy::~Ennemy() {
+    if (m_pEnemyStore != nullptr)
+        m_pEnemyStore->remove(this);
+}
+
+//! Remet l'ennemi dans son état initial, lorsqu'il est obtenu de son réservoir (GamePools).
+//! Les classes dérivées complètent cette réinitialisation (animation).
+//! Les points de vie sont donnés par EnemyStore, lorsque l'ennemi y est ajouté.
+void Ennemy::reset() {
+    setOpacity(1.0);
+    setRotation(0);
+    setVisible(true);
 }
 
 //! Fonction qui permet de créer un nuage quand l'ennemi meurt
 //! //! \param pos La position de l'ennemi
 void Ennemy::createCloudOnDeath(QPointF pos) {
-    Sprite* pCloud = new Sprite();
-    // Ajoute les images du nuage.
-    for(int index = 1; index <= 7; index++) {
-        pCloud->addAnimationFrame(GameFramework::imagesPath() +
-                                  QString("JeuZelda/Cloud%1.png").arg(index));
-    }
-    qDebug() << "Cloud created";
-    pCloud->setAnimationSpeed(25);
-    pCloud->setScale(CLOUD_SCALE_FACTOR);
+    // Le nuage est rendu à son réservoir à la fin de son animation.
+    Sprite* pCloud = GamePools::clouds().acquire();
     pCloud->setPos(pos);
-    pCloud->setEmitSignalEndOfAnimationEnabled(true);
-    // Supprime le nuage quand l'animation est terminée.
-    connect(pCloud, &Sprite::animationFinished, pCloud, &Sprite::deleteLater);
 
     // Ajoute le nuage à la scène et démarre son animation.
     parentScene()->addSpriteToScene(pCloud);
-    qDebug() << "Cloud added to scene";
     pCloud->startAnimation();
 }
 
 
 void Ennemy::createItemOnDeath(QPointF pos, int chanceToSpawnHearth, int chanceToSpawnBlueRing, int chanceToSpawnTriForce) {
     // quand l'ennemi meurt, il y a une chance sur chanceToSpawn qu'il drop un coeur
-    int randomChanceToSpawnHeart = QRandomGenerator::global()->bounded(0, chanceToSpawnHearth);
-    int randomChanceToSpawnBlueRing = QRandomGenerator::global()->bounded(0, chanceToSpawnBlueRing);
-    int randomChanceToSpawnTriForce = QRandomGenerator::global()->bounded(0, chanceToSpawnTriForce);
+    int randomChanceToSpawnHeart = GameRandom::stream(GameRandom::ITEM_DROP).bounded(0, chanceToSpawnHearth);
+    int randomChanceToSpawnBlueRing = GameRandom::stream(GameRandom::ITEM_DROP).bounded(0, chanceToSpawnBlueRing);
+    int randomChanceToSpawnTriForce = GameRandom::stream(GameRandom::ITEM_DROP).bounded(0, chanceToSpawnTriForce);
 
     // Si le random est égal à 0, on ajoute un coeur à la scène
-    if (randomChanceToSpawnHeart == 0) {
-        Sprite* pHeart = new Sprite(GameFramework::imagesPath() + "JeuZelda/HearthOnGround1.gif");
-        pHeart->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/HearthOnGround1.gif");
-        pHeart->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/HearthOnGround2.gif");
-        pHeart->setData(GameCore::SPRITE_TYPE_KEY, GameCore::HEARTDROP);
-        pHeart->setScale(GameCore::ITEM_DROP_SCALE_FACTOR);
-        // positionne le coeur au centre de l'ennemi
-        pHeart->setPos(pos.x() + (width() / 2), pos.y() + (height() / 2));
-        parentScene()->addSpriteToScene(pHeart);
-        pHeart->startAnimation(200);
-        qDebug() << "Coeur ajouté à la scène";
-
-        // si le coeur reste 3 secondes sur la scene, il clignote plus vite pour avertir le joueur de sa disparition prochaine
-        QTimer::singleShot(3000, pHeart, [pHeart]() {
-            pHeart->setAnimationSpeed(50);
-        });
-
-        // si le coeur reste 6 secondes sur la scene, on le supprime
-        QTimer::singleShot(6000, pHeart, [pHeart]() {
-            pHeart->deleteLater();
-        });
-    }
+    if (randomChanceToSpawnHeart == 0)
+        spawnItemDrop(GameCore::HEARTDROP, pos);
 
     // Si le random est égal à 0, on ajoute un blue ring à la scène
-    if(randomChanceToSpawnBlueRing == 0) {
-        Sprite* pBlueRing = new Sprite(GameFramework::imagesPath() + "JeuZelda/BlueRing.png");
-        pBlueRing->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/BlueRing.png");
-        pBlueRing->addAnimationFrame(GameFramework::imagesPath() + "jeuZelda/RedRing.png");
-        pBlueRing->setData(GameCore::SPRITE_TYPE_KEY, GameCore::BLUE_RING);
-        pBlueRing->setScale(GameCore::ITEM_DROP_SCALE_FACTOR);
-
-        // positionne le blue ring au centre de l'ennemi
-        pBlueRing->setPos(pos.x() + (width() / 2), pos.y() + (height() / 2));
-        parentScene()->addSpriteToScene(pBlueRing);
-        qDebug() << "Blue Ring ajouté à la scène";
-        pBlueRing->startAnimation(200);
-
-        // Si le blue ring reste 3 secondes sur la scene, il clignote plus vite pour avertir le joueur de sa disparition prochaine
-        QTimer::singleShot(3000, pBlueRing, [pBlueRing]() {
-            pBlueRing->setAnimationSpeed(50);
-        });
-
-        // si le blue ring reste 6 secondes sur la scene, on la supprime
-        QTimer::singleShot(6000, pBlueRing, [pBlueRing]() {
-            pBlueRing->deleteLater();
-        });
-    }
+    if (randomChanceToSpawnBlueRing == 0)
+        spawnItemDrop(GameCore::BLUE_RING, pos);
 
     // Si le random est égal à 0, on ajoute une triforce à la scène
-    if(randomChanceToSpawnTriForce == 0) {
-        Sprite* pTriForce = new Sprite(GameFramework::imagesPath() + "JeuZelda/Triforce1.gif");
-        pTriForce->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Triforce1.gif");
-        pTriForce->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Triforce2.gif");
-        pTriForce->setData(GameCore::SPRITE_TYPE_KEY, GameCore::TRIFORCE);
-        pTriForce->setScale(GameCore::ITEM_DROP_SCALE_FACTOR);
-
-        // positionne le blue ring au centre de l'ennemi
-        pTriForce->setPos(pos.x() + (width() / 2), pos.y() + (height() / 2));
-        parentScene()->addSpriteToScene(pTriForce);
-        qDebug() << "TriForce ajouté à la scène";
-        pTriForce->startAnimation(200);
-
-        // si la triforce reste 3 secondes sur la scene, elle clignote plus vite pour avertir le joueur de sa disparition prochaine
-        QTimer::singleShot(3000, pTriForce, [pTriForce]() {
-            pTriForce->setAnimationSpeed(50);
-        });
+    if (randomChanceToSpawnTriForce == 0)
+        spawnItemDrop(GameCore::TRIFORCE, pos);
+}
 
-        // si la triforce reste 6 secondes sur la scene, on la supprime
-        QTimer::singleShot(6000, pTriForce, [pTriForce]() {
-            pTriForce->deleteLater();
-        });
-    }
+//! Ajoute à la scène un objet du type donné, obtenu de son réservoir.
+//! L'objet clignote plus vite après 3 secondes, pour avertir le joueur de sa disparition
+//! prochaine, puis disparaît après 6 secondes (ItemDropTickHandler).
+//! \param spriteType  Type de l'objet (GameCore::HEARTDROP, GameCore::BLUE_RING ou GameCore::TRIFORCE).
+//! \param pos         La position de l'ennemi
+void Ennemy::spawnItemDrop(int spriteType, QPointF pos) {
+    Sprite* pItemDrop = GamePools::itemDrops(spriteType).acquire();
+    // positionne l'objet au centre de l'ennemi
+    pItemDrop->setPos(pos.x() + (width() / 2), pos.y() + (height() / 2));
+    parentScene()->addSpriteToScene(pItemDrop);
+    pItemDrop->registerForTick();
+    pItemDrop->startAnimation(200);
 }
 
-//! Supprime l'ennemi de la scene
+//! Retire l'ennemi de la scene et du magasin qui le simule, et le rend à son réservoir.
 void Ennemy::removeEnnemyFromScene() {
-    parentScene()->removeSpriteFromScene(this);
-    delete(this);
+    if (m_pEnemyStore != nullptr)
+        m_pEnemyStore->remove(this);
+    releaseToPool();
 }
 
+//! Retire un point de vie à l'ennemi.
+//! \return les points de vie qui lui restent (0 si l'ennemi ne fait pas partie d'un magasin).
+int Ennemy::loseHp() {
+    if (m_pEnemyStore == nullptr)
+        return 0;
+    return m_pEnemyStore->damage(static_cast<EnemyStore::EnemyType>(m_enemyType), m_enemySlot);
+}
+
+//! Indique au magasin qui simule l'ennemi s'il a un projectile en vol.
+void Ennemy::setAttacking(bool isAttacking) {
+    if (m_pEnemyStore != nullptr)
+        m_pEnemyStore->setAttacking(static_cast<EnemyStore::EnemyType>(m_enemyType), m_enemySlot, isAttacking);
+}
@@ -2,22 +2,37 @@
 #define ENNEMY_H
 
 #include "sprite.h"
+#include "enemystore.h"
 
 class Ennemy : public Sprite
 {
 public:
-    Ennemy(QString imagePath);
-    virtual ~Ennemy() {}
-    virtual void tick(long long elapsedTimeInMilliseconds) = 0;
+    Ennemy(const AnimationClipPointer& rpClip);
+    virtual ~Ennemy();
     virtual void damage() = 0;
+    virtual void reset();
     void createCloudOnDeath(QPointF pos);
     void createItemOnDeath(QPointF pos, int chanceToSpawnHearth, int chanceToSpawnBlueRing, int ChanceToSpawnTriforce);
     void removeEnnemyFromScene();
+    EnemyStore* enemyStore() const { return m_pEnemyStore; }
+    int enemySlot() const { return m_enemySlot; }
 
     constexpr static int CLOUD_SCALE_FACTOR = 5;
 
 protected:
-    int m_Hp;
+    virtual void releaseToPool() = 0;
+
+    int loseHp();
+    void setAttacking(bool isAttacking);
+
+private:
+    void spawnItemDrop(int spriteType, QPointF pos);
+
+    // Place de l'ennemi dans le magasin qui le simule (tenue à jour par EnemyStore).
+    friend class EnemyStore;
+    EnemyStore* m_pEnemyStore = nullptr;
+    int m_enemyType = EnemyStore::LEEVER;
+    int m_enemySlot = -1;
 };
 
 #endif // ENNEMY_H
@@ -0,0 +1,61 @@
+/**
+  \file
+  \brief    Définition de la classe FontRegistry.
+  \date     octobre 2026
+*/
+#include "fontregistry.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFontDatabase>
+
+#include "resources.h"
+
+QString FontRegistry::s_families[FontRegistry::FONT_COUNT];
+
+//! \return le nom de la famille de la police donnée, chargée au premier appel.
+QString FontRegistry::family(FontId fontId) {
+    Q_ASSERT(fontId >= 0 && fontId < FONT_COUNT);
+
+    QString& rFamily = s_families[fontId];
+    if (rFamily.isEmpty()) {
+        const QString fontPath = GameFramework::resourcesPath() + "fonts" + QDir::separator() + fileName(fontId);
+        // Le fichier de la police n'est pas distribué avec le jeu : son absence est normale.
+        if (QFile::exists(fontPath)) {
+            const int applicationFontId = QFontDatabase::addApplicationFont(fontPath);
+            rFamily = QFontDatabase::applicationFontFamilies(applicationFontId).value(0);
+            if (rFamily.isEmpty())
+                qWarning() << "Police illisible, remplacée par la police à chasse fixe du système :" << fontPath;
+        }
+        if (rFamily.isEmpty())
+            rFamily = QFontDatabase::systemFont(QFontDatabase::FixedFont).family();
+    }
+    return rFamily;
+}
+
+//! \return la police donnée, à la taille donnée.
+//! \param fontId     Police à utiliser.
+//! \param pointSize  Taille de la police, en points.
+QFont FontRegistry::font(FontId fontId, int pointSize) {
+    QFont font(family(fontId));
+    font.setPointSize(pointSize);
+    return font;
+}
+
+//! Oublie les polices chargées : elles seront à nouveau cherchées au prochain appel.
+void FontRegistry::clear() {
+    for (QString& rFamily : s_families)
+        rFamily.clear();
+}
+
+//! \return le nom du fichier de la police donnée, dans le répertoire `res/fonts`.
+QString FontRegistry::fileName(FontId fontId) {
+    switch (fontId) {
+    case PIXEL_FONT:
+        return "PixelEmulator-xq08.ttf";
+    case FONT_COUNT:
+        break;
+    }
+    return QString();
+}
@@ -0,0 +1,46 @@
+/**
+  \file
+  \brief    Déclaration de la classe FontRegistry.
+  \date     octobre 2026
+*/
+#ifndef FONTREGISTRY_H
+#define FONTREGISTRY_H
+
+#include <QFont>
+#include <QString>
+
+//! \brief Registre des polices de caractères du jeu.
+//!
+//! Les polices du jeu sont cherchées dans le répertoire `res/fonts`. Chacune est ajoutée
+//! à la base de polices de l'application (QFontDatabase) une seule fois, au premier
+//! appel à font() ou family() qui la concerne ; les appels suivants ne font que
+//! construire un QFont.
+//!
+//! Le fichier de la police pixel (PIXEL_FONT, `PixelEmulator-xq08.ttf`) n'est pas
+//! distribué avec le dépôt : il suffit de le copier dans `res/fonts` pour l'utiliser.
+//! Sans lui, la police à chasse fixe du système la remplace, sans avertissement. Un
+//! fichier présent mais illisible est signalé une seule fois.
+//!
+//! Le registre ne doit être utilisé que depuis le thread de l'interface graphique, après
+//! la création de QApplication.
+class FontRegistry
+{
+public:
+    enum FontId {
+        PIXEL_FONT,     //!< Police du jeu Zelda d'origine (NES).
+        FONT_COUNT
+    };
+
+    static QString family(FontId fontId);
+    static QFont font(FontId fontId, int pointSize);
+    static void clear();
+
+private:
+    FontRegistry() = delete;
+
+    static QString fileName(FontId fontId);
+
+    static QString s_families[FONT_COUNT];
+};
+
+#endif // FONTREGISTRY_H
@@ -6,36 +6,52 @@
 */
 #include "gamecanvas.h"
 
+#include "assetcache.h"
+#include "enemystore.h"
 #include "gamecore.h"
+#include "gamepools.h"
+#include "gamerandom.h"
 #include "gamescene.h"
 #include "gameview.h"
+#include "inputrecording.h"
+#include "startuptimer.h"
+#include "tickprofiler.h"
 
 #include <limits>
 
+#include <QDateTime>
 #include <QDebug>
+#include <QDir>
+#include <QFontDatabase>
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsItem>
 #include <QGraphicsTextItem>
 #include <QKeyEvent>
 
 const int DEFAULT_TICK_INTERVAL = 20;
-
-#ifdef QT_DEBUG
-const int STAT_TRIGGER_INTERVAL = 1000;
-#endif
+const int DEFAULT_SIMULATION_STEP = 20;
+const int DETAILED_INFOS_REFRESH_INTERVAL = 250;
 
 //!
 //! Construit le canvas de jeu, qui se charge de faire l'interface entre GameView, GameScene et GameCore.
-//! \param pView    La vue qui affiche les scènes du jeu.
+//! \param pView    La vue qui affiche les scènes du jeu, ou nullptr pour un fonctionnement
+//!                 sans affichage (voir \ref canvas_headless).
 //! \param pParent  Objet parent.
 GameCanvas::GameCanvas(GameView* pView, QObject* pParent) : QObject(pParent) {
     m_pView = pView;
+    m_pCurrentScene = nullptr;
+    m_pHudScene = nullptr;
     m_pGameCore = nullptr;
+    m_pInputRecorder = nullptr;
+    m_pInputReplayer = nullptr;
     m_pDetailedInfosItem = nullptr;
 
     m_keepTicking = false;
 
     m_tickInterval = DEFAULT_TICK_INTERVAL;
+    m_simulationStep = DEFAULT_SIMULATION_STEP;
+    m_accumulatedTime = 0;
+    m_lastStepCount = 0;
 
     m_tickTimer.setSingleShot(false);
     m_tickTimer.setInterval(m_tickInterval);
@@ -53,7 +69,8 @@ GameCanvas::GameCanvas(GameView* pView, QObject* pParent) : QObject(pParent) {
     // dans GameView, c'est trop tôt : Pour ces événements, QGraphicsView les transforme dans le système
     // de coordonnées de la scène avant de les transmettre à la scène. C'est une fois transformés
     // qu'il faut les filtrer.
-    m_pView->installEventFilter(this);
+    if (m_pView != nullptr)
+        m_pView->installEventFilter(this);
 
     QTimer::singleShot(0, this, SLOT(onInit()));
 }
@@ -67,6 +84,17 @@ GameCanvas::~GameCanvas()
 
     delete m_pGameCore;
     m_pGameCore = nullptr;
+
+    stopRecording();
+
+    delete m_pInputReplayer;
+    m_pInputReplayer = nullptr;
+
+    // Sans affichage, c'est le canvas (et non GameView) qui est propriétaire du HUD.
+    if (isHeadless()) {
+        delete m_pHudScene;
+        m_pHudScene = nullptr;
+    }
 }
 
 //! Construit une scène de jeu et lui installe un filtre d'événements pour intercepter les
@@ -101,6 +129,14 @@ GameScene* GameCanvas::createScene(qreal x, qreal y, qreal width, qreal height)
 
 //! Change la scène de jeu actuellement affichée.
 void GameCanvas::setCurrentScene(GameScene* pScene) {
+    if (m_pCurrentScene != nullptr)
+        m_pCurrentScene->clearRenderInterpolation();
+
+    m_pCurrentScene = pScene;
+
+    if (m_pView == nullptr)
+        return;
+
     m_pView->setScene(pScene);
     m_pView->updateSceneDisplaySize(); // nécessaire pour ajuster l'affichage
                                        // si la scène doit être "fit in view"
@@ -108,42 +144,51 @@ void GameCanvas::setCurrentScene(GameScene* pScene) {
 
 //! \return un pointeur sur la scène qui est actuellement affichée par GameView.
 GameScene* GameCanvas::currentScene() const {
-    return static_cast<GameScene*>(m_pView->scene());
+    return m_pCurrentScene;
 }
 
 //! Détermine la scène qui sera affichée comme HUD.
 //! \param pHudScene Scène à afficher comme HUD.
 void GameCanvas::setHudScene(QGraphicsScene* pHudScene) {
-    if (hudScene())
-        hudScene()->removeItem(m_pDetailedInfosItem);
+    if (pHudScene == m_pHudScene)
+        return;
+
+    if (m_pHudScene && m_pDetailedInfosItem)
+        m_pHudScene->removeItem(m_pDetailedInfosItem);
+
+    if (m_pView != nullptr)
+        m_pView->setHudScene(pHudScene);
+    else
+        delete m_pHudScene;
 
-    m_pView->setHudScene(pHudScene);
-    pHudScene->addItem(m_pDetailedInfosItem);
+    m_pHudScene = pHudScene;
+    if (m_pHudScene && m_pDetailedInfosItem)
+        m_pHudScene->addItem(m_pDetailedInfosItem);
 }
 
 //! \return la scène utilisée comme HUD.
 QGraphicsScene* GameCanvas::hudScene() const {
-    return m_pView->hudScene();
+    return m_pHudScene;
 }
 
 //!
 //! Démarre la génération d'un tick sur une base de temps régulière,
 //! donnée en paramètre.
-//! \param tickInterval  Intervalle de temps (en millisecondes) entre chaque tick. Si cette valeur est
-//! inférieure à zéro, l'intervalle de temps précédent est utilisé.
+//! \param tickInterval  Intervalle de temps (en millisecondes) entre chaque rafraîchissement
+//! de l'affichage (voir \ref canvas_timestep). Si cette valeur est inférieure à zéro,
+//! l'intervalle de temps précédent est utilisé.
 //!
 void GameCanvas::startTick(int tickInterval)  {
-    if (tickInterval != KEEP_PREVIOUS_TICK_INTERVAL) {
-        m_tickInterval = tickInterval;
-        m_tickTimer.setInterval(tickInterval);
-    }
+    if (tickInterval != KEEP_PREVIOUS_TICK_INTERVAL)
+        setFrameInterval(tickInterval);
 
-#ifdef QT_DEBUG
-    resetStatistics();
-#endif
     m_keepTicking = true;
+    m_accumulatedTime = 0;
     m_lastUpdateTime.start();
-    m_tickTimer.start();
+
+    // Sans affichage, la cadence est produite par simulateTick().
+    if (!isHeadless())
+        m_tickTimer.start();
 }
 
 //!
@@ -151,7 +196,38 @@ void GameCanvas::startTick(int tickInterval)  {
 //!
 void GameCanvas::stopTick()  {
     m_keepTicking = false;
-    m_tickTimer.stop();
+
+    if (m_pCurrentScene != nullptr)
+        m_pCurrentScene->clearRenderInterpolation();
+
+    // Pendant le rejeu, la minuterie continue de tourner : c'est elle qui fait
+    // avancer l'enregistrement, y compris les touches qui relancent la cadence.
+    if (!isReplaying())
+        m_tickTimer.stop();
+}
+
+//! Change l'intervalle de temps entre deux rafraîchissements de l'affichage
+//! (voir \ref canvas_timestep).
+//! \param frameInterval  Intervalle de temps en millisecondes (au minimum 1).
+void GameCanvas::setFrameInterval(int frameInterval) {
+    m_tickInterval = qMax(1, frameInterval);
+    m_tickTimer.setInterval(m_tickInterval);
+}
+
+//! \return l'intervalle de temps (en millisecondes) entre deux rafraîchissements de l'affichage.
+int GameCanvas::frameInterval() const {
+    return m_tickInterval;
+}
+
+//! Change la durée d'un pas de simulation (voir \ref canvas_timestep).
+//! \param simulationStep  Durée en millisecondes (au minimum 1).
+void GameCanvas::setSimulationStep(int simulationStep) {
+    m_simulationStep = qMax(1, simulationStep);
+}
+
+//! \return la durée (en millisecondes) d'un pas de simulation.
+int GameCanvas::simulationStep() const {
+    return m_simulationStep;
 }
 
 //!
@@ -163,22 +239,116 @@ bool GameCanvas::isTicking() const {
 
 //! Enclenche le suivi du déplacement de la souris.
 void GameCanvas::startMouseTracking() {
-    m_pView->setMouseTracking(true);
+    if (m_pView != nullptr)
+        m_pView->setMouseTracking(true);
 }
 
 //! Déclenche le suivi du déplacement de la souris.
 void GameCanvas::stopMouseTracking() {
-    m_pView->setMouseTracking(false);
+    if (m_pView != nullptr)
+        m_pView->setMouseTracking(false);
 }
 
 //!
 //! \return la position actuelle de la souris, dans le système de coordonnées de la scène actuelle.
+//! Sans affichage, la position retournée est toujours (0, 0).
 //!
 QPointF GameCanvas::currentMousePosition() const
 {
+    if (m_pView == nullptr)
+        return QPointF();
+
     return m_pView->mapToScene(m_pView->mapFromGlobal(QCursor::pos()));
 }
 
+//! Produit un tick avec le temps écoulé donné, sans attendre la minuterie.
+//! Utilisé sans affichage (voir \ref canvas_headless) pour faire avancer le jeu
+//! aussi vite que possible avec un temps synthétique.
+//! Comme pour l'affichage, ce temps est découpé en pas de simulation fixes (voir
+//! \ref canvas_timestep), mais les sprites ne sont pas interpolés.
+//! Si la cadence est stoppée (stopTick()), cette fonction ne fait rien.
+//! \param elapsedTimeInMilliseconds  Temps (synthétique) écoulé depuis l'appel précédent.
+void GameCanvas::simulateTick(long long elapsedTimeInMilliseconds) {
+    if (m_pGameCore == nullptr)
+        return;
+
+    TraceZone zone("Frame");
+
+    if (isReplaying()) {
+        replayStep();
+        return;
+    }
+
+    if (!m_keepTicking)
+        return;
+
+    m_lastUpdateTime.start();
+    advanceSimulation(qMax(1LL, elapsedTimeInMilliseconds));
+}
+
+//! Simule l'appui sur une touche du clavier.
+//! \param key  Numéro de la touche (voir les constantes Qt).
+void GameCanvas::simulateKeyPress(int key) {
+    if (m_pGameCore != nullptr)
+        dispatchKeyPressed(key);
+}
+
+//! Simule le relâchement d'une touche du clavier.
+//! \param key  Numéro de la touche (voir les constantes Qt).
+void GameCanvas::simulateKeyRelease(int key) {
+    if (m_pGameCore != nullptr)
+        dispatchKeyReleased(key);
+}
+
+//! Démarre l'enregistrement des entrées dans le fichier donné (voir \ref canvas_replay).
+//! \param rFilePath  Chemin du fichier d'enregistrement.
+//! \return un booléen à faux si l'enregistrement n'a pas pu démarrer.
+bool GameCanvas::startRecording(const QString& rFilePath) {
+    stopRecording();
+
+    m_pInputRecorder = new InputRecorder;
+    if (!m_pInputRecorder->start(rFilePath, GameRandom::seed())) {
+        stopRecording();
+        return false;
+    }
+    return true;
+}
+
+//! Termine l'enregistrement en cours.
+void GameCanvas::stopRecording() {
+    delete m_pInputRecorder;
+    m_pInputRecorder = nullptr;
+}
+
+//! \return un booléen qui indique si les entrées sont en train d'être enregistrées.
+bool GameCanvas::isRecording() const {
+    return m_pInputRecorder != nullptr;
+}
+
+//! Démarre le rejeu de l'enregistrement donné (voir \ref canvas_replay).
+//! La graine de partie est remplacée par celle de l'enregistrement : le rejeu doit
+//! donc être démarré avant que la partie ne commence.
+//! \param rFilePath  Chemin du fichier d'enregistrement.
+//! \return un booléen à faux si l'enregistrement ne peut pas être lu.
+bool GameCanvas::startReplay(const QString& rFilePath) {
+    InputReplayer* pReplayer = new InputReplayer;
+    if (!pReplayer->open(rFilePath)) {
+        delete pReplayer;
+        return false;
+    }
+
+    delete m_pInputReplayer;
+    m_pInputReplayer = pReplayer;
+    GameRandom::setSeed(m_pInputReplayer->seed());
+    qInfo() << "Rejeu de" << rFilePath << ":" << m_pInputReplayer->tickCount() << "ticks";
+    return true;
+}
+
+//! \return un booléen qui indique si un enregistrement est en train d'être rejoué.
+bool GameCanvas::isReplaying() const {
+    return m_pInputReplayer != nullptr;
+}
+
 //! Filtre et dispatch les événements intéressants de la scène.
 bool GameCanvas::eventFilter(QObject* pWatched, QEvent* pEvent)
 {
@@ -218,7 +388,8 @@ void GameCanvas::initDetailedInfos()
     m_pDetailedInfosItem->setPos(0,20);
     m_pDetailedInfosItem->setZValue(std::numeric_limits<qreal>::max()); // Toujours devant les autres items
     m_pDetailedInfosItem->hide();
-    QFont textFont = m_pDetailedInfosItem->font();
+    // Police à chasse fixe, afin que les colonnes des mesures (TickProfiler::report()) soient alignées.
+    QFont textFont = QFontDatabase::systemFont(QFontDatabase::FixedFont);
     textFont.setPixelSize(15);
     m_pDetailedInfosItem->setFont(textFont);
 }
@@ -230,21 +401,36 @@ void GameCanvas::keyPressed(QKeyEvent* pKeyEvent) {
     if (pKeyEvent->isAutoRepeat())
         pKeyEvent->ignore();
     else {
-        m_pGameCore->keyPressed(pKeyEvent->key());
+        dispatchKeyPressed(pKeyEvent->key());
 
         if (pKeyEvent->modifiers()==(Qt::ShiftModifier|Qt::ControlModifier)) {
             switch (pKeyEvent->key()) {
             case Qt::Key_I:
-                if (m_pDetailedInfosItem)
+                if (m_pDetailedInfosItem) {
                     m_pDetailedInfosItem->setVisible(!m_pDetailedInfosItem->isVisible());
+                    // Les mesures par phase ne sont faites que lorsqu'elles sont affichées.
+                    TickProfiler::setEnabled(m_pDetailedInfosItem->isVisible());
+                    m_detailedInfosRefreshTimer.invalidate();
+                }
+                break;
+            case Qt::Key_T:
+                toggleTraceRecording();
                 break;
             case Qt::Key_P:
-                m_tickTimer.setInterval(m_tickTimer.interval()+1);
-                qDebug() << "Tick interval set to " << m_tickTimer.interval();
+                setFrameInterval(frameInterval()+1);
+                qDebug() << "Frame interval set to " << frameInterval();
                 break;
             case Qt::Key_M:
-                m_tickTimer.setInterval(m_tickTimer.interval()-1);
-                qDebug() << "Tick interval set to " << m_tickTimer.interval();
+                setFrameInterval(frameInterval()-1);
+                qDebug() << "Frame interval set to " << frameInterval();
+                break;
+            case Qt::Key_K:
+                setSimulationStep(simulationStep()+1);
+                qDebug() << "Simulation step set to " << simulationStep();
+                break;
+            case Qt::Key_J:
+                setSimulationStep(simulationStep()-1);
+                qDebug() << "Simulation step set to " << simulationStep();
                 break;
             }
         }
@@ -258,11 +444,35 @@ void GameCanvas::keyReleased(QKeyEvent* pKeyEvent) {
     if (pKeyEvent->isAutoRepeat())
         pKeyEvent->ignore();
     else {
-        m_pGameCore->keyReleased(pKeyEvent->key());
+        dispatchKeyReleased(pKeyEvent->key());
         pKeyEvent->accept();
     }
 }
 
+//! Transmet l'appui sur une touche à GameCore, en l'enregistrant si nécessaire.
+//! Pendant le rejeu, seules les touches enregistrées sont transmises.
+void GameCanvas::dispatchKeyPressed(int key) {
+    if (isReplaying())
+        return;
+
+    ProfileZone zone(TickProfiler::INPUT);
+    if (m_pInputRecorder != nullptr)
+        m_pInputRecorder->recordKeyPress(key);
+    m_pGameCore->keyPressed(key);
+}
+
+//! Transmet le relâchement d'une touche à GameCore, en l'enregistrant si nécessaire.
+//! Pendant le rejeu, seules les touches enregistrées sont transmises.
+void GameCanvas::dispatchKeyReleased(int key) {
+    if (isReplaying())
+        return;
+
+    ProfileZone zone(TickProfiler::INPUT);
+    if (m_pInputRecorder != nullptr)
+        m_pInputRecorder->recordKeyRelease(key);
+    m_pGameCore->keyReleased(key);
+}
+
 //! Gère le déplacement de la souris.
 //! Pour que cet événement soit pris en compte, la propriété MouseTracking de GameView
 //! doit être enclenchée.
@@ -289,18 +499,28 @@ void GameCanvas::mouseButtonReleased(QGraphicsSceneMouseEvent* pMouseEvent) {
 //! afin que GameCore n'appelle pas la fonction startTick alors que le signaux
 //! ne sont pas encore connectés.
 void GameCanvas::onInit() {
+    StartupTimer::mark(StartupTimer::CANVAS_INITIALIZED);
+
     // Mise en place d'un HUD par défaut
-    QGraphicsScene* pHud = new QGraphicsScene(0,0, m_pView->width(), 50);
+    QGraphicsScene* pHud = new QGraphicsScene(0,0, m_pView != nullptr ? m_pView->width() : 0, 50);
     setHudScene(pHud);
 
     m_pGameCore = new GameCore(this, this);
 }
 
 
-//! Traite le tick : le temps exact écoulé entre ce tick et le tick précédent
-//! est mesuré et l'objet GameCore est lui-même informé du tick.
-//! Poursuit la génération du tick si nécessaire.
+//! Traite le rafraîchissement de l'affichage : le temps exact écoulé depuis le
+//! rafraîchissement précédent est mesuré et consommé par des pas de simulation fixes
+//! (voir \ref canvas_timestep), puis les sprites sont affichés entre leurs deux
+//! dernières positions.
 void GameCanvas::onTick() {
+    TraceZone zone("Frame");
+
+    if (isReplaying()) {
+        replayStep();
+        return;
+    }
+
     long long elapsedTime = m_lastUpdateTime.elapsed();
 
     // On évite une division par zéro (peu probable, mais on sait jamais)
@@ -309,45 +529,124 @@ void GameCanvas::onTick() {
 
     m_lastUpdateTime.start();
 
-#ifdef QT_DEBUG
-    // Statistiques
-    m_tickCount++;
-    m_totalElapsedTime += elapsedTime;
-#endif
+    advanceSimulation(elapsedTime);
 
-    // Tick
-    m_pGameCore->tick(elapsedTime);
-    currentScene()->tick(elapsedTime);
+    // Si la cadence a été stoppée durant la simulation, les sprites restent à leur position réelle.
+    if (m_keepTicking && currentScene() != nullptr)
+        currentScene()->interpolateRendering(static_cast<qreal>(m_accumulatedTime) / m_simulationStep);
 
     if (m_pDetailedInfosItem && m_pDetailedInfosItem->isVisible())
-        m_pDetailedInfosItem->setPlainText(QString("FPS : %1, Elapsed : %2ms, Tick duration : %3ms")
+        updateDetailedInfos(elapsedTime);
+}
+
+//! Met à jour les informations détaillées (touches Ctrl+Shift+I) : cadence d'affichage,
+//! pas de simulation, réflexions des ennemis (EnemyStore::thinkStatistics()), cache d'images
+//! (AssetCache), occupation des réservoirs d'objets (GamePools) et percentiles de la durée de chaque phase du tick (TickProfiler).
+//! Le texte est recalculé au plus toutes les DETAILED_INFOS_REFRESH_INTERVAL millisecondes,
+//! afin de rester lisible et de ne pas fausser les mesures qu'il affiche.
+//! \param elapsedTime  Temps écoulé (en millisecondes) depuis le rafraîchissement précédent.
+void GameCanvas::updateDetailedInfos(long long elapsedTime) {
+    if (m_detailedInfosRefreshTimer.isValid() && m_detailedInfosRefreshTimer.elapsed() < DETAILED_INFOS_REFRESH_INTERVAL)
+        return;
+    m_detailedInfosRefreshTimer.start();
+
+    const EnemyStore* pEnemyStore = m_pGameCore->enemyStore();
+    const EnemyStore::ThinkStatistics& rThinks = pEnemyStore->thinkStatistics();
+    const QString thinkInfos = QString("AI thinks : %1 / %2 per tick, Pending : %3, Latency : %4ms avg, %5ms max")
+                               .arg(rThinks.thinkCount)
+                               .arg(pEnemyStore->thinkBudget())
+                               .arg(rThinks.pendingCount)
+                               .arg(rThinks.averageLatency, 0, 'f', 1)
+                               .arg(rThinks.maxLatency);
+
+    const QString cacheInfos = QString("Image cache : %1 hit(s), %2 miss(es)")
+                               .arg(AssetCache::hitCount())
+                               .arg(AssetCache::missCount());
+
+    m_pDetailedInfosItem->setPlainText(QString("FPS : %1, Elapsed : %2ms, Steps : %3 x %4ms, Tick duration : %5ms\n%6\n%7\n%8\n%9")
                                       .arg(1000/elapsedTime)
                                       .arg(elapsedTime)
-                                      .arg(m_lastUpdateTime.elapsed()));
-
-#ifdef QT_DEBUG
-    // Statistiques
-    m_statsTrigger -= elapsedTime;
-    if (m_statsTrigger < 0) {
-        //qDebug() << "Tick count :" << m_tickCount << ". Mean tick duration : " << m_totalElapsedTime / m_tickCount << ". Min duration : " << m_minTickDuration << ". Max duration : " << m_maxTickDuration;
-        resetStatistics();
+                                      .arg(m_lastStepCount)
+                                      .arg(m_simulationStep)
+                                      .arg(m_lastUpdateTime.elapsed())
+                                      .arg(thinkInfos)
+                                      .arg(cacheInfos)
+                                      .arg(GamePools::report())
+                                      .arg(TickProfiler::report()));
+}
+
+//! Démarre l'enregistrement d'une trace (TraceRecorder) dans un nouveau fichier du
+//! répertoire courant, ou termine l'enregistrement en cours.
+void GameCanvas::toggleTraceRecording() {
+    if (TraceRecorder::isRecording()) {
+        TraceRecorder::stop();
+        return;
     }
 
-    if (m_lastUpdateTime.elapsed() > m_maxTickDuration)
-        m_maxTickDuration = m_lastUpdateTime.elapsed();
-    else if (m_lastUpdateTime.elapsed() < m_minTickDuration)
-        m_minTickDuration = m_lastUpdateTime.elapsed();
-#endif
+    const QString fileName = QString("trace-%1.json").arg(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss"));
+    TraceRecorder::start(QDir::current().filePath(fileName));
 }
 
-#ifdef QT_DEBUG
-//! Remet à zéro les compteurs pour les statistiques en mode debug.
-void GameCanvas::resetStatistics() {
-    m_tickCount = 0;
-    m_totalElapsedTime = 0;
-    m_maxTickDuration = std::numeric_limits<int>::min();
-    m_minTickDuration = std::numeric_limits<int>::max();
+//! Ajoute le temps donné au temps accumulé, puis produit autant de pas de simulation
+//! que ce dernier le permet, au maximum MAX_CATCH_UP_STEPS (voir \ref canvas_timestep).
+//! \param elapsedTime  Temps écoulé (en millisecondes) depuis l'appel précédent.
+void GameCanvas::advanceSimulation(long long elapsedTime) {
+    // Le temps qui ne pourrait pas être rattrapé est abandonné : le jeu ralentit
+    // plutôt que d'accumuler un retard qui ne ferait que croître.
+    m_accumulatedTime += qMin(elapsedTime, static_cast<long long>(MAX_CATCH_UP_STEPS) * m_simulationStep);
+
+    m_lastStepCount = 0;
+    while (m_keepTicking && m_accumulatedTime >= m_simulationStep) {
+        m_accumulatedTime -= m_simulationStep;
+        m_lastStepCount++;
+        processTick(m_simulationStep);
+    }
+}
 
-    m_statsTrigger = STAT_TRIGGER_INTERVAL;
+//! Informe GameCore et la scène courante du tick (un pas de simulation).
+//! \param elapsedTime  Temps écoulé (en millisecondes) depuis le tick précédent.
+void GameCanvas::processTick(long long elapsedTime) {
+    if (m_pInputRecorder != nullptr)
+        m_pInputRecorder->recordTick(elapsedTime);
+
+    // Tick
+    {
+        ProfileZone zone(TickProfiler::TICK);
+        currentScene()->beginSimulationStep();
+        m_pGameCore->tick(elapsedTime);
+        currentScene()->tick(elapsedTime);
+    }
+    TickProfiler::commitTick();
+}
+
+//! Rejoue les touches enregistrées jusqu'au prochain tick enregistré, puis
+//! produit ce tick avec le temps écoulé enregistré.
+//! À la fin de l'enregistrement, la cadence est stoppée et replayFinished() est émis.
+void GameCanvas::replayStep() {
+    InputRecorder::RecordType recordType;
+    quint64 recordValue;
+    while (m_pInputReplayer->readRecord(recordType, recordValue)) {
+        switch (recordType) {
+        case InputRecorder::KEY_PRESS: {
+            ProfileZone zone(TickProfiler::INPUT);
+            m_pGameCore->keyPressed(static_cast<int>(recordValue));
+            break;
+        }
+        case InputRecorder::KEY_RELEASE: {
+            ProfileZone zone(TickProfiler::INPUT);
+            m_pGameCore->keyReleased(static_cast<int>(recordValue));
+            break;
+        }
+        case InputRecorder::TICK:
+            m_lastUpdateTime.start();
+            processTick(static_cast<long long>(recordValue));
+            return;
+        }
+    }
+
+    qInfo() << "Rejeu terminé";
+    delete m_pInputReplayer;
+    m_pInputReplayer = nullptr;
+    stopTick();
+    emit replayFinished();
 }
-#endif
@@ -15,6 +15,8 @@
 
 class GameCore;
 class GameScene;
+class InputRecorder;
+class InputReplayer;
 class GameView;
 class QGraphicsScene;
 class QGraphicsSceneMouseEvent;
@@ -48,17 +50,64 @@ class QKeyEvent;
 //!
 //! Pour stopper le tick, utiliser la commande stopTick().
 //!
+//! \section canvas_timestep Pas de simulation fixe
+//! L'affichage et la simulation ont chacun leur propre cadence :
+//!
+//! - l'affichage est rafraîchi par une minuterie, toutes les frameInterval() millisecondes
+//!   (setFrameInterval() ou startTick()) ;
+//! - la simulation avance par pas de temps fixes de simulationStep() millisecondes
+//!   (setSimulationStep()) : GameCore::tick() et GameScene::tick() reçoivent toujours
+//!   ce même temps écoulé.
+//!
+//! Le temps réellement écoulé entre deux rafraîchissements est accumulé, puis consommé
+//! par autant de pas de simulation que nécessaire. Pour qu'une machine trop lente ne
+//! prenne pas de plus en plus de retard, le nombre de pas rattrapés par rafraîchissement
+//! est limité (MAX_CATCH_UP_STEPS) : au-delà, le jeu ralentit. Le temps restant sert
+//! à afficher les sprites entre leurs deux dernières positions (voir \ref scene_interpolation).
+//!
+//! Les deux cadences peuvent être modifiées en cours de jeu, y compris avec les touches
+//! Ctrl+Shift+P et Ctrl+Shift+M (rafraîchissement) et Ctrl+Shift+K et Ctrl+Shift+J (simulation).
+//!
 //! GameCanvas permet également d'enclencher le suivi des déplacements de la souris (startMouseTracking() et de
 //! le stopper (stopMouseTracking()).
 //!
 //! Si GameCanvas émet le signal requestToCloseApp(), cela provoque la fermeture de l'application.
+//!
+//! \section canvas_headless Mode sans affichage
+//! Si aucune vue n'est donnée au constructeur, GameCanvas fonctionne sans affichage
+//! (isHeadless()) : les scènes sont gérées normalement, mais ne sont pas affichées, et
+//! startTick() ne démarre pas de minuterie. La cadence est alors produite par l'appelant
+//! avec simulateTick(), qui reçoit un temps écoulé synthétique, et les touches du clavier
+//! sont simulées avec simulateKeyPress() et simulateKeyRelease().
+//! C'est ce que fait HeadlessRunner pour faire tourner le jeu aussi vite que possible.
+//!
+//! \section canvas_replay Enregistrement et rejeu
+//! startRecording() enregistre (InputRecorder) toutes les touches transmises à GameCore
+//! ainsi que le temps écoulé de chaque tick. startReplay() rejoue un tel enregistrement
+//! (InputReplayer) : le clavier est alors ignoré et chaque tick reçoit le temps écoulé
+//! enregistré, ce qui reproduit la partie à l'identique, avec la même graine de partie
+//! (GameRandom). À la fin du rejeu, la cadence est stoppée et le signal replayFinished()
+//! est émis.
+//!
+//! \section canvas_profiling Mesure des phases du tick
+//! Les touches Ctrl+Shift+I affichent les informations détaillées : cadence d'affichage,
+//! pas de simulation et, pour chaque phase du tick (entrées, joueur, ennemis, vagues,
+//! collisions, scène, animations, dessin), les percentiles 50, 95 et 99 et le maximum
+//! de sa durée sur les derniers ticks. Ces mesures (TickProfiler) ne sont faites que
+//! tant que les informations détaillées sont affichées.
+//!
+//! Les touches Ctrl+Shift+T démarrent, puis terminent, l'enregistrement d'une trace
+//! (TraceRecorder) dans un fichier `trace-<date>-<heure>.json` du répertoire courant.
+//! Cette trace contient chaque image, chaque phase du tick, le tick de chaque ennemi,
+//! les requêtes de collision, la génération des vagues et le dessin de la vue et du HUD.
 class GameCanvas : public QObject
 {
     Q_OBJECT
 public:
     enum { KEEP_PREVIOUS_TICK_INTERVAL = -1  };
+    enum { MAX_CATCH_UP_STEPS = 5 };
 
-    explicit GameCanvas(GameView* pView, QObject* pParent = nullptr);
+    explicit GameCanvas(GameView* pView = nullptr, QObject* pParent = nullptr);
     ~GameCanvas() override;
 
 
@@ -76,14 +125,33 @@ public:
     void stopTick();
     bool isTicking() const;
 
+    void setFrameInterval(int frameInterval);
+    int frameInterval() const;
+
+    void setSimulationStep(int simulationStep);
+    int simulationStep() const;
+
     void startMouseTracking();
     void stopMouseTracking();
     QPointF currentMousePosition() const;
 
     GameView* gameView() const { return m_pView; }
+    bool isHeadless() const { return m_pView == nullptr; }
+
+    void simulateTick(long long elapsedTimeInMilliseconds);
+    void simulateKeyPress(int key);
+    void simulateKeyRelease(int key);
+
+    bool startRecording(const QString& rFilePath);
+    void stopRecording();
+    bool isRecording() const;
+
+    bool startReplay(const QString& rFilePath);
+    bool isReplaying() const;
 
 signals:
     void requestToCloseApp();
+    void replayFinished();
 
 public slots:
 
@@ -100,25 +168,31 @@ private:
     void mouseButtonPressed(QGraphicsSceneMouseEvent* pMouseEvent);
     void mouseButtonReleased(QGraphicsSceneMouseEvent* pMouseEvent);
 
+    void dispatchKeyPressed(int key);
+    void dispatchKeyReleased(int key);
+    void advanceSimulation(long long elapsedTimeInMilliseconds);
+    void processTick(long long elapsedTimeInMilliseconds);
+    void replayStep();
+    void updateDetailedInfos(long long elapsedTimeInMilliseconds);
+    void toggleTraceRecording();
+
     GameView* m_pView;
+    GameScene* m_pCurrentScene;
+    QGraphicsScene* m_pHudScene;
     GameCore* m_pGameCore;
+    InputRecorder* m_pInputRecorder;
+    InputReplayer* m_pInputReplayer;
     QPointer<QGraphicsTextItem> m_pDetailedInfosItem; // Smart Pointer pour qu'il soit mis à zéro au cas où l'item est effacé par GameScene::clear()
 
     bool m_keepTicking;
     int m_tickInterval;
+    int m_simulationStep;
+    long long m_accumulatedTime;
+    int m_lastStepCount;
 
     QElapsedTimer m_lastUpdateTime;
     QTimer m_tickTimer;
-
-#ifdef QT_DEBUG
-    void resetStatistics();
-
-    int m_tickCount;
-    int m_totalElapsedTime;
-    int m_maxTickDuration;
-    int m_minTickDuration;
-    int m_statsTrigger;
-#endif
+    QElapsedTimer m_detailedInfosRefreshTimer;
 
 private slots:
     void onInit();
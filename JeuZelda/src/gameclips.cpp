@@ -0,0 +1,81 @@
+/**
+  \file
+  \brief    Définition de la classe GameClips.
+  \date     octobre 2026
+*/
+#include "gameclips.h"
+
+#include "assetregistry.h"
+
+AnimationClipPointer GameClips::s_clips[GameClips::CLIP_COUNT];
+
+namespace {
+
+//! Description d'une animation du jeu.
+struct ClipDefinition {
+    const char* pName;
+    QVector<AssetRegistry::AssetId> assetIds;
+    int frameDuration;
+    AnimationClip::LoopMode loopMode;
+};
+
+//! \return la description de l'animation donnée.
+//! Pour les ennemis, les feux et les objets, la première image est présente deux fois,
+//! comme dans les listes d'images qu'ils se construisaient auparavant.
+ClipDefinition clipDefinition(GameClips::ClipId clipId) {
+    switch (clipId) {
+    case GameClips::LEEVER:
+        return { "Leever", { AssetRegistry::LEEVER_1, AssetRegistry::LEEVER_1, AssetRegistry::LEEVER_2 }, 100, AnimationClip::LOOP };
+    case GameClips::RED_LEEVER:
+        return { "Leever rouge", { AssetRegistry::RED_LEEVER_1, AssetRegistry::RED_LEEVER_1, AssetRegistry::RED_LEEVER_2 }, 100, AnimationClip::LOOP };
+    case GameClips::OCTOPUS:
+        return { "Octopus", { AssetRegistry::OCTOPUS_1, AssetRegistry::OCTOPUS_1, AssetRegistry::OCTOPUS_2 }, 100, AnimationClip::LOOP };
+    case GameClips::FIRE:
+        return { "Feu", { AssetRegistry::FIRE_1, AssetRegistry::FIRE_1, AssetRegistry::FIRE_2 }, 100, AnimationClip::LOOP };
+    case GameClips::HEART_DROP:
+        return { "Coeur", { AssetRegistry::HEART_DROP_1, AssetRegistry::HEART_DROP_1, AssetRegistry::HEART_DROP_2 }, 200, AnimationClip::LOOP };
+    case GameClips::BLUE_RING_DROP:
+        return { "Blue ring", { AssetRegistry::BLUE_RING, AssetRegistry::BLUE_RING, AssetRegistry::RED_RING }, 200, AnimationClip::LOOP };
+    case GameClips::TRIFORCE_DROP:
+        return { "Triforce", { AssetRegistry::TRIFORCE_1, AssetRegistry::TRIFORCE_1, AssetRegistry::TRIFORCE_2 }, 200, AnimationClip::LOOP };
+    case GameClips::CLOUD:
+        return { "Nuage", { AssetRegistry::CLOUD_1, AssetRegistry::CLOUD_2, AssetRegistry::CLOUD_3, AssetRegistry::CLOUD_4,
+                            AssetRegistry::CLOUD_5, AssetRegistry::CLOUD_6, AssetRegistry::CLOUD_7 },
+                 25, AnimationClip::ONCE };
+    case GameClips::LINK_WALK_DOWN:
+        return { "Link marche vers le bas", { AssetRegistry::LINK_DOWN_1, AssetRegistry::LINK_DOWN_2 }, 0, AnimationClip::LOOP };
+    case GameClips::LINK_WALK_UP:
+        return { "Link marche vers le haut", { AssetRegistry::LINK_UP_1, AssetRegistry::LINK_UP_2 }, 0, AnimationClip::LOOP };
+    case GameClips::LINK_WALK_LEFT:
+        return { "Link marche vers la gauche", { AssetRegistry::LINK_LEFT_1, AssetRegistry::LINK_LEFT_2 }, 0, AnimationClip::LOOP };
+    case GameClips::LINK_WALK_RIGHT:
+        return { "Link marche vers la droite", { AssetRegistry::LINK_RIGHT_1, AssetRegistry::LINK_RIGHT_2 }, 0, AnimationClip::LOOP };
+    case GameClips::CLIP_COUNT:
+        break;
+    }
+    return { "", {}, 0, AnimationClip::LOOP };
+}
+
+} // namespace
+
+//! \return l'animation donnée, construite et enregistrée au premier appel.
+AnimationClipPointer GameClips::clip(ClipId clipId) {
+    Q_ASSERT(clipId >= 0 && clipId < CLIP_COUNT);
+
+    AnimationClipPointer& rpClip = s_clips[clipId];
+    if (rpClip.isNull()) {
+        const ClipDefinition definition = clipDefinition(clipId);
+        QStringList imagePaths;
+        for (AssetRegistry::AssetId assetId : definition.assetIds)
+            imagePaths << AssetRegistry::path(assetId);
+        rpClip = AnimationClip::registerClip(definition.pName, imagePaths, definition.frameDuration, definition.loopMode);
+    }
+    return rpClip;
+}
+
+//! Oublie les animations du jeu et vide le registre d'AnimationClip.
+void GameClips::clear() {
+    for (AnimationClipPointer& rpClip : s_clips)
+        rpClip.reset();
+    AnimationClip::clearRegistry();
+}
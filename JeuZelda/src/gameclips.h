@@ -0,0 +1,47 @@
+/**
+  \file
+  \brief    Déclaration de la classe GameClips.
+  \date     octobre 2026
+*/
+#ifndef GAMECLIPS_H
+#define GAMECLIPS_H
+
+#include "animationclip.h"
+
+//! \brief Animations partagées par les sprites du jeu.
+//!
+//! Chaque animation (ClipId) est construite et enregistrée auprès d'AnimationClip au
+//! premier appel à clip(), lorsque ses images ont été préchargées (AssetPreloader), puis
+//! partagée par tous les sprites qui l'affichent : tous les Leevers, tous les feux ou
+//! tous les nuages utilisent la même suite d'images.
+//!
+//! clear() doit être appelé avant la destruction de QApplication.
+class GameClips
+{
+public:
+    enum ClipId {
+        LEEVER,
+        RED_LEEVER,
+        OCTOPUS,
+        FIRE,
+        HEART_DROP,
+        BLUE_RING_DROP,
+        TRIFORCE_DROP,
+        CLOUD,
+        LINK_WALK_DOWN,     //!< Marche du joueur ; les quatre directions suivent l'ordre de Player::Direction.
+        LINK_WALK_UP,
+        LINK_WALK_LEFT,
+        LINK_WALK_RIGHT,
+        CLIP_COUNT
+    };
+
+    static AnimationClipPointer clip(ClipId clipId);
+    static void clear();
+
+private:
+    GameClips() = delete;
+
+    static AnimationClipPointer s_clips[CLIP_COUNT];
+};
+
+#endif // GAMECLIPS_H
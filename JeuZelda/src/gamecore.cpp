@@ -10,19 +10,31 @@
 #include <QDebug>
 #include <QSettings>
 #include <QMovie>
-#include <QFontDatabase>
 
+#include "assetpreloader.h"
+#include "bulletengine.h"
+#include "bulletpatterns.h"
 #include "gamescene.h"
 #include "gamecanvas.h"
 #include "resources.h"
 #include "utilities.h"
 #include "sprite.h"
 #include "player.h"
+#include "projectile.h"
+#include "enemystore.h"
 #include "ennemifactory.h"
 #include "EnnemiLeever.h"
 #include "ennemileeverrouge.h"
 #include "ennemioctopus.h"
 #include "decor.h"
+#include "fontregistry.h"
+#include "gameclips.h"
+#include "gamepools.h"
+#include "gamerandom.h"
+#include "startuptimer.h"
+#include "statictextitem.h"
+#include "tickprofiler.h"
+#include "timerwheel.h"
 
 //! Initialise le contrôleur de jeu.
 //! \param pGameCanvas  GameCanvas pour lequel cet objet travaille.
@@ -31,6 +43,12 @@ GameCore::GameCore(GameCanvas* pGameCanvas, QObject* pParent) : QObject(pParent)
 
     m_playerSpeed = 10;
 
+    // Chaque partie utilise la même suite de nombres aléatoires (voir GameRandom).
+    GameRandom::reset();
+
+    // Simulation des ennemis, dont les sprites ne sont que les représentants.
+    m_pEnemyStore = new EnemyStore;
+
     // Mémorise l'accès au canvas (qui gère le tick et l'affichage d'une scène)
     m_pGameCanvas = pGameCanvas;
 
@@ -41,6 +59,17 @@ GameCore::GameCore(GameCanvas* pGameCanvas, QObject* pParent) : QObject(pParent)
     // Trace un rectangle blanc tout autour des limites de la scène.
     m_pScene->addRect(m_pScene->sceneRect(), QPen(Qt::white));
 
+    // Les salves des Octopus sont simulées et dessinées par le moteur de projectiles,
+    // devant les sprites. Il est détruit avec la scène.
+    m_pBulletEngine = new BulletEngine(m_pScene->sceneRect());
+    m_pBulletEngine->setZValue(1);
+    m_pScene->addItem(m_pBulletEngine);
+
+    // Les images de l'écran de démarrage doivent être prêtes ; celles des niveaux
+    // continuent d'être préchargées pendant que cet écran est affiché.
+    AssetPreloader::waitFor(AssetPreloader::MENU_ASSETS);
+    StartupTimer::mark(StartupTimer::MENU_ASSETS_READY);
+
     // Crée un nouveau joueur
     m_pPlayer = new Player();
     m_pScene->addSpriteToScene(m_pPlayer);
@@ -52,6 +81,7 @@ GameCore::GameCore(GameCanvas* pGameCanvas, QObject* pParent) : QObject(pParent)
 
     // Rend le joueur invisible au début du jeu
     m_pPlayer->setVisible(false);
+    m_pBulletEngine->setTarget(m_pPlayer);
 
     // Création des ennemis grâce à la classe EnnemiFactory
     // EnnemiFactory* ennemifactory = new EnnemiFactory(m_pScene, m_pPlayer);
@@ -76,12 +106,21 @@ GameCore::GameCore(GameCanvas* pGameCanvas, QObject* pParent) : QObject(pParent)
 
     // Affiche le meilleur score du joueur
     displayBestScore();
+
+    StartupTimer::mark(StartupTimer::MENU_DISPLAYED);
 }
 
 //! Destructeur de GameCore : efface les scènes
 GameCore::~GameCore() {
     delete m_pScene;
     m_pScene = nullptr;
+
+    // Les sprites recyclés qui ne faisaient pas partie de la scène sont détruits.
+    GamePools::clear();
+
+    // Les ennemis détruits avec la scène se sont retirés du magasin.
+    delete m_pEnemyStore;
+    m_pEnemyStore = nullptr;
 }
 
 void GameCore::keyPressed(int key) {
@@ -92,14 +131,18 @@ void GameCore::keyPressed(int key) {
         if(m_gameMode == START) {
             m_gameMode = RUNNING;
 
+            // Les images du niveau ont été préchargées pendant l'écran de démarrage.
+            AssetPreloader::waitFor(AssetPreloader::GAMEPLAY_ASSETS);
+            AssetPreloader::waitFor(AssetPreloader::LEVEL_1_ASSETS);
+
             // Création des décors
-            Decor* pBush1 = new Decor(GameFramework::imagesPath() + "JeuZelda/Bush.png", 200, 200);
+            Decor* pBush1 = new Decor(AssetRegistry::BUSH, 200, 200);
             m_pScene->addSpriteToScene(pBush1);
 
-            Decor* pBush2 = new Decor(GameFramework::imagesPath() + "JeuZelda/Bush.png", 300, 550);
+            Decor* pBush2 = new Decor(AssetRegistry::BUSH, 300, 550);
             m_pScene->addSpriteToScene(pBush2);
 
-            Decor* pRock1 = new Decor(GameFramework::imagesPath() + "JeuZelda/Rock.png", 1000, 200);
+            Decor* pRock1 = new Decor(AssetRegistry::ROCK, 1000, 200);
             m_pScene->addSpriteToScene(pRock1);
 
             // Fond d'écran de la scène.
@@ -116,35 +159,39 @@ void GameCore::keyPressed(int key) {
         if(m_gameMode == START) {
             m_gameMode = RUNNING;
 
+            // Les images du niveau ont été préchargées pendant l'écran de démarrage.
+            AssetPreloader::waitFor(AssetPreloader::GAMEPLAY_ASSETS);
+            AssetPreloader::waitFor(AssetPreloader::LEVEL_2_ASSETS);
+
             // Création des décors
-            Decor* pBush1 = new Decor(GameFramework::imagesPath() + "JeuZelda/Bush.png", 200, 200);
+            Decor* pBush1 = new Decor(AssetRegistry::BUSH, 200, 200);
             m_pScene->addSpriteToScene(pBush1);
 
-            Decor* pBush2 = new Decor(GameFramework::imagesPath() + "JeuZelda/Bush.png", 300, 550);
+            Decor* pBush2 = new Decor(AssetRegistry::BUSH, 300, 550);
             m_pScene->addSpriteToScene(pBush2);
 
-            Decor* pBush3 = new Decor(GameFramework::imagesPath() + "JeuZelda/Bush.png", 900, 400);
+            Decor* pBush3 = new Decor(AssetRegistry::BUSH, 900, 400);
             m_pScene->addSpriteToScene(pBush3);
 
-            Decor* pRock1 = new Decor(GameFramework::imagesPath() + "JeuZelda/Rock.png", 1000, 200);
+            Decor* pRock1 = new Decor(AssetRegistry::ROCK, 1000, 200);
             m_pScene->addSpriteToScene(pRock1);
 
             // boucle qui permet de générer le bord de l'eau en bas de la scène
             for(int i = 0; i < m_pScene->width(); i += 50) {
-                Sprite* pWater = new Sprite(GameFramework::imagesPath() + "JeuZelda/WaterBorderUp.png");
+                Sprite* pWater = new Sprite(AssetRegistry::WATER_BORDER_UP);
                 m_pScene->addSpriteToScene(pWater);
                 pWater->setPos(i, m_pScene->height() - 50);
                 pWater->setScale(WATER_SCALE_FACTOR);
-                pWater->setData(SPRITE_TYPE_KEY, SpriteType::DECOR);
+                pWater->setSpriteType(SpriteType::DECOR);
             }
 
             // boucle qui permet de générer le bord de l'eau en haut de la scène
             for(int i = 0; i < m_pScene->width(); i += 50) {
-                Sprite* pWater = new Sprite(GameFramework::imagesPath() + "JeuZelda/WaterBorderDown.png");
+                Sprite* pWater = new Sprite(AssetRegistry::WATER_BORDER_DOWN);
                 m_pScene->addSpriteToScene(pWater);
                 pWater->setPos(i, 0);
                 pWater->setScale(WATER_SCALE_FACTOR);
-                pWater->setData(SPRITE_TYPE_KEY, SpriteType::DECOR);
+                pWater->setSpriteType(SpriteType::DECOR);
             }
 
             // Fond d'écran de la scène.
@@ -161,66 +208,55 @@ void GameCore::keyPressed(int key) {
         if(m_gameMode == START) {
             m_gameMode = RUNNING;
 
+            // Les images du niveau ont été préchargées pendant l'écran de démarrage.
+            AssetPreloader::waitFor(AssetPreloader::GAMEPLAY_ASSETS);
+            AssetPreloader::waitFor(AssetPreloader::LEVEL_3_ASSETS);
+
             // Création des décors
-            Decor* pRock1 = new Decor(GameFramework::imagesPath() + "JeuZelda/WhiteRock.png", 200, 200);
+            Decor* pRock1 = new Decor(AssetRegistry::WHITE_ROCK, 200, 200);
             m_pScene->addSpriteToScene(pRock1);
 
-            Decor* pRock2 = new Decor(GameFramework::imagesPath() + "JeuZelda/WhiteRock.png", 650, 500);
+            Decor* pRock2 = new Decor(AssetRegistry::WHITE_ROCK, 650, 500);
             m_pScene->addSpriteToScene(pRock2);
 
-            Decor* pBush = new Decor(GameFramework::imagesPath() + "JeuZelda/WhiteBush.png", 1010, 350);
+            Decor* pBush = new Decor(AssetRegistry::WHITE_BUSH, 1010, 350);
             m_pScene->addSpriteToScene(pBush);
 
             // Création du feu
-            Sprite* pFire = new Sprite(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_2.gif");
-            pFire->setAnimationSpeed(100);
+            Sprite* pFire = new Sprite(GameClips::clip(GameClips::FIRE));
             pFire->startAnimation();
             m_pScene->addSpriteToScene(pFire);
             pFire->setScale(DECOR_SCALE_FACTOR);
             pFire->setPos(100, 100);
-            pFire->setData(SPRITE_TYPE_KEY, SpriteType::FIRE);
+            pFire->setSpriteType(SpriteType::FIRE);
 
-            Sprite* pFire2 = new Sprite(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire2->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire2->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_2.gif");
-            pFire2->setAnimationSpeed(100);
+            Sprite* pFire2 = new Sprite(GameClips::clip(GameClips::FIRE));
             pFire2->startAnimation();
             m_pScene->addSpriteToScene(pFire2);
             pFire2->setScale(DECOR_SCALE_FACTOR);
             pFire2->setPos(700, 180);
-            pFire2->setData(SPRITE_TYPE_KEY, SpriteType::FIRE);
+            pFire2->setSpriteType(SpriteType::FIRE);
 
-            Sprite* pFire3 = new Sprite(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire3->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire3->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_2.gif");
-            pFire3->setAnimationSpeed(100);
+            Sprite* pFire3 = new Sprite(GameClips::clip(GameClips::FIRE));
             pFire3->startAnimation();
             m_pScene->addSpriteToScene(pFire3);
             pFire3->setScale(DECOR_SCALE_FACTOR);
             pFire3->setPos(1000, 70);
-            pFire3->setData(SPRITE_TYPE_KEY, SpriteType::FIRE);
+            pFire3->setSpriteType(SpriteType::FIRE);
 
-            Sprite* pFire4 = new Sprite(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire4->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire4->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_2.gif");
-            pFire4->setAnimationSpeed(100);
+            Sprite* pFire4 = new Sprite(GameClips::clip(GameClips::FIRE));
             pFire4->startAnimation();
             m_pScene->addSpriteToScene(pFire4);
             pFire4->setScale(DECOR_SCALE_FACTOR);
             pFire4->setPos(900, 550);
-            pFire4->setData(SPRITE_TYPE_KEY, SpriteType::FIRE);
+            pFire4->setSpriteType(SpriteType::FIRE);
 
-            Sprite* pFire5 = new Sprite(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire5->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_1.gif");
-            pFire5->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Fire_2.gif");
-            pFire5->setAnimationSpeed(100);
+            Sprite* pFire5 = new Sprite(GameClips::clip(GameClips::FIRE));
             pFire5->startAnimation();
             m_pScene->addSpriteToScene(pFire5);
             pFire5->setScale(DECOR_SCALE_FACTOR);
             pFire5->setPos(300, 400);
-            pFire5->setData(SPRITE_TYPE_KEY, SpriteType::FIRE);
+            pFire5->setSpriteType(SpriteType::FIRE);
 
             // Fond d'écran de la scène.
             m_pScene->setBackgroundColor(QColor(120, 116, 116));
@@ -353,23 +389,41 @@ void GameCore::keyReleased(int key) {
 //! \param elapsedTimeInMilliseconds Le temps écoulé depuis le dernier appel à cette fonction.
 //! Cette fonction est appelée à chaque tick du jeu.
 void GameCore::tick(long long elapsedTimeInMilliseconds) {
-    m_pPlayer->tick(static_cast<int>(elapsedTimeInMilliseconds));
+    // Les zones de mesure (ProfileZone) attribuent le temps de chaque partie du tick
+    // à sa phase (voir \ref canvas_profiling).
+    {
+        ProfileZone zone(TickProfiler::PLAYER);
+        m_pPlayer->tick(static_cast<int>(elapsedTimeInMilliseconds));
+    }
 
-    auto children = m_pScene->items();
+    {
+        ProfileZone zone(TickProfiler::ENEMIES);
+        // Les ennemis sont simulés par lots dans leurs colonnes, puis leurs sprites
+        // sont mis à jour une seule fois (voir EnemyStore). Les ennemis éloignés du
+        // joueur réfléchissent moins souvent.
+        m_pEnemyStore->setPlayerPosition(m_pPlayer->sceneBoundingRect().center());
+        m_pEnemyStore->update(elapsedTimeInMilliseconds, m_pScene->sceneRect().size());
+        m_pEnemyStore->syncProxies(elapsedTimeInMilliseconds);
+    }
 
-    // Boucle qui permet de faire bouger les ennemies grâce au tick
-    for(auto child: children) {
-        if (Ennemy* ennemi = dynamic_cast<Ennemy*>(child)) {
-            ennemi->tick(elapsedTimeInMilliseconds);
-        }
+    {
+        ProfileZone zone(TickProfiler::BULLETS);
+        m_pBulletEngine->tick(elapsedTimeInMilliseconds);
+        if (m_gameMode == RUNNING)
+            collideBullets();
+    }
+
+    {
+        ProfileZone zone(TickProfiler::WAVES);
+        // Appel de la fonction qui compte le nombre d'ennemi encore en vie sur la scène
+        countEnnemies();
+        // Appel de la fonction qui génère une nouvelle vague d'ennemis si aucun ennemi n'est présent sur la scène
+        generateEnemyWave();
     }
-    // Appel de la fonction qui compte le nombre d'ennemi encore en vie sur la scène
-    countEnnemies();
-    // Appel de la fonction qui génère une nouvelle vague d'ennemis si aucun ennemi n'est présent sur la scène
-    generateEnemyWave();
 
     // Si le joueur est en train de jouer, on efface les informations de l'écran de début
     if(m_gameMode == RUNNING) {
+        ProfileZone zone(TickProfiler::PLAYER);
         // Rend le joueur visible au lancement de la partie
         m_pPlayer->setVisible(true);
         // Permet au joueur de se déplacer
@@ -384,12 +438,18 @@ void GameCore::tick(long long elapsedTimeInMilliseconds) {
         m_pPlayer->setVisible(false);
     }
 
-    QList<Sprite*> collisions = m_pScene->collidingSprites(m_pPlayer);
+    QList<Sprite*> collisions;
+    {
+        ProfileZone zone(TickProfiler::COLLISIONS);
+        collisions = m_pScene->collidingSprites(m_pPlayer);
+    }
+
+    ProfileZone pickupsZone(TickProfiler::PICKUPS);
     bool isCollidingWithDecor = false;
 
     if (!collisions.isEmpty()) {
         Sprite* pCollisionned = collisions.at(0);
-        if (pCollisionned->data(SPRITE_TYPE_KEY).toInt() == DECOR) {
+        if (pCollisionned->spriteType() == DECOR) {
             isCollidingWithDecor = true;
 
             // Déterminer la direction de la collision
@@ -417,27 +477,19 @@ void GameCore::tick(long long elapsedTimeInMilliseconds) {
                     m_pPlayer->setY(m_pPlayer->y() + m_playerSpeed);
                 }
             }
-        } else if (pCollisionned->data(SPRITE_TYPE_KEY).toInt() == ENNEMI || pCollisionned->data(SPRITE_TYPE_KEY).toInt() == FIRE) {
+        } else if (pCollisionned->spriteType() == ENNEMI || pCollisionned->spriteType() == FIRE) {
             // Le joueur prend des dégâts
             m_pPlayer->damage();
-            if(m_pPlayer->isDead) {
-                m_gameMode = ENDED_LOSE;
-                if (m_pGameCanvas->isTicking()) {
-                    m_pGameCanvas->stopTick();
-                }
-                displayInformation("Game Over !");
-                qDebug() << "Le joueur est mort";
-            }
-        } else if (pCollisionned->data(SPRITE_TYPE_KEY).toInt() == HEARTDROP) {
+            checkPlayerDeath();
+        } else if (pCollisionned->spriteType() == HEARTDROP) {
             // Ajoute un coeur au joueur si il en a moin de MAX_HEARTH
             if(m_pPlayer->m_pHearts.length() < MAX_HEARTH) {
                 m_pPlayer->addHeart();
                 qDebug() << "Coeur ajouté";
             }
             // supprime le coeur de la scène une fois que le joueur l'a touchée
-            m_pScene->removeSpriteFromScene(pCollisionned);
-            delete pCollisionned;
-        } else if(pCollisionned->data(SPRITE_TYPE_KEY).toInt() == BLUE_RING) {
+            GamePools::releaseItemDrop(pCollisionned);
+        } else if(pCollisionned->spriteType() == BLUE_RING) {
             // Le projectile (épée) du joueur va 2 fois plus vite pendant 5 secondes
             qDebug() << "Blue Ring touché";
             // Si le joueur n'a pas déjà l'effet d'un Blue Ring, alors il gagne l'effet
@@ -445,40 +497,63 @@ void GameCore::tick(long long elapsedTimeInMilliseconds) {
                 m_pPlayer->swordSpeed = 1000.0;
             }
 
-            // Après 5 secondes, la vitesse de l'épée du joueur revient à la normale
-            QTimer::singleShot(5000, m_pPlayer, [this]() {
+            // Après 5 secondes de jeu, la vitesse de l'épée du joueur revient à la normale
+            m_pScene->timerWheel()->schedule(5000, [this]() {
                 m_pPlayer->swordSpeed = 550.0;
-            });
+            }, m_pPlayer);
             // supprime le Blue Ring de la scène une fois que le joueur l'a touchée
-            m_pScene->removeSpriteFromScene(pCollisionned);
-            delete pCollisionned;
-        } else if(pCollisionned->data(SPRITE_TYPE_KEY).toInt() == TRIFORCE) {
+            GamePools::releaseItemDrop(pCollisionned);
+        } else if(pCollisionned->spriteType() == TRIFORCE) {
             // Tous les ennemis de la scène perde 1 hp
-            auto children = m_pScene->items();
-            for(auto child: children) {
-                if (Ennemy* ennemi = dynamic_cast<Ennemy*>(child)) {
-                    ennemi->damage();
-                }
+            const QVector<Sprite*> ennemies = m_pScene->spritesOfType(ENNEMI);
+            for(Sprite* pSprite : ennemies) {
+                static_cast<Ennemy*>(pSprite)->damage();
             }
             // supprime la triforce de la scène une fois que le joueur l'a touchée
-            m_pScene->removeSpriteFromScene(pCollisionned);
-            delete pCollisionned;
+            GamePools::releaseItemDrop(pCollisionned);
         }
     }
 }
 
-//! Fonction qui compte le nombre d'ennemi sur la scène
-//! \return le nombre d'ennemi sur la scène
-int GameCore::countEnnemies() {
-    int nbreEnnemi = 0;
-    auto children = m_pScene->items();
+//! Passe de collision du moteur de projectiles : les projectiles qui touchent le joueur
+//! le blessent, ceux qui touchent son épée ou le décor sont simplement retirés.
+void GameCore::collideBullets() {
+    if (m_pBulletEngine->count() == 0)
+        return;
+
+    // Le premier rectangle est celui du joueur.
+    QVector<QRectF> targets;
+    targets.append(m_pPlayer->globalBoundingRect());
+    if (m_pPlayer->m_pSword != nullptr)
+        targets.append(m_pPlayer->m_pSword->globalBoundingRect());
+    const QVector<Sprite*> decors = m_pScene->spritesOfType(DECOR);
+    for (Sprite* pDecor : decors)
+        targets.append(pDecor->globalBoundingRect());
+
+    QVector<int> hitCounts;
+    m_pBulletEngine->collide(targets, hitCounts);
+    if (hitCounts.first() > 0) {
+        m_pPlayer->damage();
+        checkPlayerDeath();
+    }
+}
 
-    for(auto child: children) {
-        if (Ennemy* ennemi = dynamic_cast<Ennemy*>(child)) {
-            nbreEnnemi++;
+//! Termine la partie si le joueur n'a plus de coeur.
+void GameCore::checkPlayerDeath() {
+    if(m_pPlayer->isDead) {
+        m_gameMode = ENDED_LOSE;
+        if (m_pGameCanvas->isTicking()) {
+            m_pGameCanvas->stopTick();
         }
+        displayInformation("Game Over !");
+        qDebug() << "Le joueur est mort";
     }
-    return nbreEnnemi;
+}
+
+//! Fonction qui compte le nombre d'ennemi sur la scène
+//! \return le nombre d'ennemi sur la scène
+int GameCore::countEnnemies() {
+    return m_pScene->spriteCount(ENNEMI);
 }
 
 //! Génère une nouvelle vague d'ennemis si la scène est vide.
@@ -487,8 +562,9 @@ int GameCore::countEnnemies() {
 void GameCore::generateEnemyWave() {
     // Vérifier s'il y a déjà des ennemis sur la scène
     if (countEnnemies() == 0) {
+        TraceZone zone("spawnWave");
         // Créer une nouvelle vague d'ennemis
-        EnnemiFactory* ennemiFactory = new EnnemiFactory(m_pScene, m_pPlayer);
+        EnnemiFactory* ennemiFactory = new EnnemiFactory(m_pScene, m_pPlayer, m_pEnemyStore, m_pBulletEngine);
 
         int nbreEnnemiLeever = 0;
         int nbreEnnemiLeeverRouge = 0;
@@ -497,7 +573,7 @@ void GameCore::generateEnemyWave() {
         if(m_gameMode == RUNNING) {
             for(int i = 0; i < m_currentWave; i++) {
                 // Générer un nombre aléatoire entre 0 et 5 inclus
-                int random = QRandomGenerator::global()->bounded(0, 5);
+                int random = GameRandom::stream(GameRandom::WAVE).bounded(0, 5);
                 // Si le nombre est 0, créer un ennemi Leever Rouge
                 if (random == 0 && m_currentWave > 2) {
                     nbreEnnemiLeeverRouge++;
@@ -510,7 +586,9 @@ void GameCore::generateEnemyWave() {
                 }
             }
             // Créer la vague d'ennemis
-            ennemiFactory->createWave(nbreEnnemiLeever, nbreEnnemiLeeverRouge, nbreEnnemiOctopus);
+            // Dans les vagues avancées, les Octopus tirent des salves (voir BulletPatterns).
+            ennemiFactory->createWave(nbreEnnemiLeever, nbreEnnemiLeeverRouge, nbreEnnemiOctopus,
+                                      BulletPatterns::patternForWave(m_currentWave));
 
             // Afficher le numéro de la vague
             displayWaves(m_currentWave);
@@ -527,18 +605,11 @@ void GameCore::generateEnemyWave() {
 void GameCore::displayInformation(const QString& rMessage) {
     clearDisplayInformation();
 
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police
-    QFont customFont(ZeldaFont);
-
-    // Agrandit le texte
-    customFont.setPointSize(30);
+    // Police du jeu de base Zelda (NES), chargée une seule fois par FontRegistry.
+    const QFont customFont = FontRegistry::font(FontRegistry::PIXEL_FONT, 30);
 
     // Créer l'élément texte avec la police personnalisée
-    QGraphicsSimpleTextItem* pText = m_pScene->createText(QPointF(0,0), rMessage, 50, Qt::red);
+    StaticTextItem* pText = m_pScene->createText(QPointF(0,0), rMessage, 50, Qt::red);
     pText->setFont(customFont);
 
     // Centrer le texte
@@ -555,47 +626,27 @@ void GameCore::displayWaves(int waveNumber) {
     // Construire le message avec le numéro de la vague
     QString message = "Wave " + QString::number(waveNumber);
 
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police personnalisée
-    QFont customFont(ZeldaFont);
-
     // Vérifier si le texte existe déjà, sinon le créer
     if (!m_pDisplayedNumberWaves) {
         // Affichage du message en gras avec la police personnalisée.
         m_pDisplayedNumberWaves = m_pScene->createText(QPointF(0, 0), message, 50, Qt::red);
 
-        // Agrandit le texte
-        customFont.setPointSize(30);
-
         // Place le texte en haut à droite de l'écran
         m_pDisplayedNumberWaves->setX(m_pScene->width() - m_pDisplayedNumberWaves->boundingRect().width() - 80);
 
-        // Applique la police mise à jour
-        m_pDisplayedNumberWaves->setFont(customFont);
+        // Applique la police du jeu de base Zelda (NES), agrandie
+        m_pDisplayedNumberWaves->setFont(FontRegistry::font(FontRegistry::PIXEL_FONT, 30));
     } else {
-        // Mettre à jour le texte existant avec la nouvelle police
+        // Mettre à jour le texte existant : seule sa mise en page est recalculée.
         m_pDisplayedNumberWaves->setText(message);
-
-        // Agrandit le texte
-        customFont.setPointSize(30);
-
-        // Applique la police mise à jour
-        m_pDisplayedNumberWaves->setFont(customFont);
     }
 }
 
 //! \brief GameCore::displayLevelInformation
 //! Affiche les levels et le titre du jeu
 void GameCore::displayLevelInformation() {
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police personnalisée
-    QFont customFont(ZeldaFont);
+    // Police du jeu de base Zelda (NES), chargée une seule fois par FontRegistry.
+    QFont customFont(FontRegistry::family(FontRegistry::PIXEL_FONT));
 
     // Vérifier si le texte existe déjà, sinon le créer
     if (!m_pDisplayedLevelInformation) {
@@ -626,12 +677,8 @@ void GameCore::displayLevelInformation() {
 //! \brief GameCore::displayItemsInformation
 //! Affiche les items et leur utilité
 void GameCore::displayItemsInformation() {
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police personnalisée
-    QFont customFont(ZeldaFont);
+    // Police du jeu de base Zelda (NES), chargée une seule fois par FontRegistry.
+    QFont customFont(FontRegistry::family(FontRegistry::PIXEL_FONT));
 
     // Affichage du message en gras avec la police personnalisée.
     m_pDisplayedtextHeart = m_pScene->createText(QPointF(0, 0), "Heart : gives to player an extra hearth", 50, Qt::white);
@@ -642,10 +689,7 @@ void GameCore::displayItemsInformation() {
     customFont.setPointSize(16);
 
     // Crée un Coeur
-    Sprite* pHeart = new Sprite(GameFramework::imagesPath() + "JeuZelda/HearthOnGround1.gif");
-    pHeart->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/HearthOnGround1.gif");
-    pHeart->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/HearthOnGround2.gif");
-    pHeart->setAnimationSpeed(200);
+    Sprite* pHeart = new Sprite(GameClips::clip(GameClips::HEART_DROP));
     pHeart->startAnimation();
     m_pScene->addSpriteToScene(pHeart);
     pHeart->setScale(ITEM_DROP_SCALE_FACTOR);
@@ -660,10 +704,7 @@ void GameCore::displayItemsInformation() {
     m_pDisplayedtextHeart->setFont(customFont);
 
     // Crée un Blue Ring
-    Sprite* pBlueRing = new Sprite(GameFramework::imagesPath() + "JeuZelda/BlueRing.png");
-    pBlueRing->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/BlueRing.png");
-    pBlueRing->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/RedRing.png");
-    pBlueRing->setAnimationSpeed(200);
+    Sprite* pBlueRing = new Sprite(GameClips::clip(GameClips::BLUE_RING_DROP));
     pBlueRing->startAnimation();
     m_pScene->addSpriteToScene(pBlueRing);
     pBlueRing->setScale(ITEM_DROP_SCALE_FACTOR);
@@ -678,10 +719,7 @@ void GameCore::displayItemsInformation() {
     m_pDisplayedtextBlueRing->setFont(customFont);
 
     // Crée une triforce
-    Sprite* pTriforce = new Sprite(GameFramework::imagesPath() + "JeuZelda/Triforce1.gif");
-    pTriforce->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Triforce1.gif");
-    pTriforce->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Triforce2.gif");
-    pTriforce->setAnimationSpeed(200);
+    Sprite* pTriforce = new Sprite(GameClips::clip(GameClips::TRIFORCE_DROP));
     pTriforce->startAnimation();
     m_pScene->addSpriteToScene(pTriforce);
     pTriforce->setScale(ITEM_DROP_SCALE_FACTOR);
@@ -699,12 +737,8 @@ void GameCore::displayItemsInformation() {
 //! \brief GameCore::displayEnnemyInformation
 //! Affiche les ennemis et leur nom
 void GameCore::displayEnnemyInformation() {
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police personnalisée
-    QFont customFont(ZeldaFont);
+    // Police du jeu de base Zelda (NES), chargée une seule fois par FontRegistry.
+    QFont customFont(FontRegistry::family(FontRegistry::PIXEL_FONT));
 
     // Affichage du message en gras avec la police personnalisée.
     m_pDisplayedtextLeever = m_pScene->createText(QPointF(0, 0), "Leever", 50, Qt::white);
@@ -715,14 +749,11 @@ void GameCore::displayEnnemyInformation() {
     customFont.setPointSize(16);
 
     // Crée un Sprite reprsentant un ennemi Leever
-    Sprite* pLeever = new Sprite(GameFramework::imagesPath() + "JeuZelda/Ennemi1_1.gif");
-    pLeever->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Ennemi1_1.gif");
-    pLeever->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Ennemi1_2.gif");
+    Sprite* pLeever = new Sprite(GameClips::clip(GameClips::LEEVER));
     pLeever->setAnimationSpeed(200);
     pLeever->startAnimation();
     m_pScene->addSpriteToScene(pLeever);
     pLeever->setScale(START_ENNEMY_SCALE_FACTOR);
-    pLeever->setData(SPRITE_TYPE_KEY, SpriteType::ENNEMI);
     pLeever->setPos(100, 500);
     m_pLeever = pLeever;
 
@@ -734,14 +765,11 @@ void GameCore::displayEnnemyInformation() {
     m_pDisplayedtextLeever->setFont(customFont);
 
     // Crée un Sprite représentant un ennemi Leever Rouge
-    Sprite* pLeeverRouge = new Sprite(GameFramework::imagesPath() + "JeuZelda/Ennemi2_1.gif");
-    pLeeverRouge->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Ennemi2_1.gif");
-    pLeeverRouge->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/Ennemi2_2.gif");
+    Sprite* pLeeverRouge = new Sprite(GameClips::clip(GameClips::RED_LEEVER));
     pLeeverRouge->setAnimationSpeed(200);
     pLeeverRouge->startAnimation();
     m_pScene->addSpriteToScene(pLeeverRouge);
     pLeeverRouge->setScale(START_ENNEMY_SCALE_FACTOR);
-    pLeeverRouge->setData(SPRITE_TYPE_KEY, SpriteType::ENNEMI);
     pLeeverRouge->setPos(100, 560);
     m_pLeeverRouge = pLeeverRouge;
 
@@ -753,13 +781,10 @@ void GameCore::displayEnnemyInformation() {
     m_pDisplayedtextLeeverRouge->setFont(customFont);
 
     // Crée une Sprite représentant un ennemi Octopus
-    Sprite* pOctopus = new Sprite(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_1.gif");
-    pOctopus->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_1.gif");
-    pOctopus->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/EnnemiOctopus_2.gif");
+    Sprite* pOctopus = new Sprite(GameClips::clip(GameClips::OCTOPUS));
     pOctopus->setAnimationSpeed(200);
     pOctopus->startAnimation();
     m_pScene->addSpriteToScene(pOctopus);
-    pOctopus->setData(SPRITE_TYPE_KEY, SpriteType::ENNEMI);
     pOctopus->setScale(START_ENNEMY_SCALE_FACTOR);
     pOctopus->setPos(100, 620);
     m_pOctopus = pOctopus;
@@ -776,12 +801,8 @@ void GameCore::displayEnnemyInformation() {
 //! Affiche le meilleur score
 //! Le meilleur score correspond à la vague maximum atteint par le joueur.
 void GameCore::displayBestScore() {
-    // Charger la police personnalisée (police du jeu de base Zelda (NES))
-    int id = QFontDatabase::addApplicationFont("C:\\Users\\fresale\\JeuZelda\\res\\fonts\\PixelEmulator-xq08.ttf");
-    QString ZeldaFont = QFontDatabase::applicationFontFamilies(id).at(0);
-
-    // Créer la police personnalisée
-    QFont customFont(ZeldaFont);
+    // Police du jeu de base Zelda (NES), chargée une seule fois par FontRegistry.
+    QFont customFont(FontRegistry::family(FontRegistry::PIXEL_FONT));
 
     // Affichage du message en gras avec la police personnalisée.
     m_pDisplayedBestScore = m_pScene->createText(QPointF(0, 0), "Best Score : " + QString::number(m_bestScore), 50, Qt::white);
@@ -895,14 +916,10 @@ void GameCore::clearBestScoreInformation() {
 //! \param spriteType Type du sprite à supprimer
 //! Supprime un sprite de la scène en fonction de son type
 void GameCore::removeSpriteByType(int spriteType) {
-    auto children = m_pScene->items();
-    for(auto child : children) {
-        if(Sprite* sprite = dynamic_cast<Sprite*>(child)) {
-            if(sprite->data(SPRITE_TYPE_KEY).toInt() == spriteType) {
-                m_pScene->removeSpriteFromScene(sprite);
-                delete sprite;
-            }
-        }
+    const QVector<Sprite*> sprites = m_pScene->spritesOfType(spriteType);
+    for(Sprite* pSprite : sprites) {
+        m_pScene->removeSpriteFromScene(pSprite);
+        delete pSprite;
     }
 }
 
@@ -911,21 +928,23 @@ void GameCore::removeSpriteByType(int spriteType) {
 //! Réinitialise le jeu
 void GameCore::restartGame() {
     // Supprime tous les ennemi et les projectiles de la scène
-    auto children = m_pScene->items();
-    for(auto child: children) {
-        if (Ennemy* ennemi = dynamic_cast<Ennemy*>(child)) {
-            if(EnnemiOctopus* ennemiOctopus = dynamic_cast<EnnemiOctopus*>(child)) {
-                ennemiOctopus->removeProjectile();
-            }
-            m_pScene->removeSpriteFromScene(ennemi);
-            delete ennemi;
+    const QVector<Sprite*> ennemies = m_pScene->spritesOfType(ENNEMI);
+    // Les ennemis sont rendus à leur réservoir (avec leur projectile), pour la prochaine partie.
+    for(Sprite* pSprite : ennemies) {
+        static_cast<Ennemy*>(pSprite)->removeEnnemyFromScene();
+    }
+    // Les salves encore en vol disparaissent avec eux.
+    m_pBulletEngine->clear();
+
+    // Rend tous les items de la scène (coeur, blue ring et triforce) à leur réservoir
+    for(int itemDropType : { HEARTDROP, BLUE_RING, TRIFORCE }) {
+        const QVector<Sprite*> itemDrops = m_pScene->spritesOfType(itemDropType);
+        for(Sprite* pItemDrop : itemDrops) {
+            GamePools::releaseItemDrop(pItemDrop);
         }
     }
 
-    // Supprime tous les items de la scène par type (coeur, blue ring, triforce, décor et feu)
-    removeSpriteByType(HEARTDROP);
-    removeSpriteByType(BLUE_RING);
-    removeSpriteByType(TRIFORCE);
+    // Supprime le décor et le feu de la scène
     removeSpriteByType(DECOR);
     removeSpriteByType(FIRE);
 
@@ -940,18 +959,23 @@ void GameCore::restartGame() {
     // Supprime l'épée du joueur si elle est encore présente au moment du Game Over
     m_pPlayer->removeSword();
 
-    // Supprime le joueur
+    // Supprime le joueur, qui n'est plus la cible des salves
+    m_pBulletEngine->setTarget(nullptr);
     delete m_pPlayer;
 
     // Réinitialise le numéro de vague
     m_currentWave = 1;
 
+    // La nouvelle partie reprend la suite de nombres aléatoires depuis le début
+    GameRandom::reset();
+
     // Réinitialise le joueur
     m_pPlayer = new Player();
     m_pScene->addSpriteToScene(m_pPlayer);
     m_pPlayer->setOffset(-m_pPlayer->sceneBoundingRect().width()/2, -m_pPlayer->sceneBoundingRect().width()/2);
     m_pPlayer->setScale(PLAYER_SCALE_FACTOR);
     m_pPlayer->setPos(m_pScene->width()/2.0, m_pScene->height()/2.0);
+    m_pBulletEngine->setTarget(m_pPlayer);
 
     // Réinitialise le mode de jeu à START
     m_gameMode = START;
@@ -980,28 +1004,32 @@ void GameCore::restartGame() {
 
 void GameCore::updatePlayer() {
     // Déplacer le personnage en fonction de l'état des touches
+    // Seule l'animation active change selon la direction : les images de marche
+    // ont été chargées une fois pour toutes par le joueur.
     if(!m_pressedKeys.isEmpty()) {
         int mostRecentKey = m_pressedKeys.first();
-        if (mostRecentKey == Qt::Key_Left && m_pPlayer->x() - m_playerSpeed >= 0) {
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/LeftLink_2.gif");
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/LeftLink_1.gif");
-            m_pPlayer->setX(m_pPlayer->x() - m_playerSpeed);
+        if (mostRecentKey == Qt::Key_Left) {
+            m_pPlayer->walk(Player::LEFT);
+            if (m_pPlayer->x() - m_playerSpeed >= 0)
+                m_pPlayer->setX(m_pPlayer->x() - m_playerSpeed);
         }
-        if (mostRecentKey == Qt::Key_Right && m_pPlayer->x() + m_playerSpeed <= m_pScene->width() - m_pPlayer->sceneBoundingRect().width()) {
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/RightLink_2.gif");
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/RightLink_1.gif");
-            m_pPlayer->setX(m_pPlayer->x() + m_playerSpeed);
+        if (mostRecentKey == Qt::Key_Right) {
+            m_pPlayer->walk(Player::RIGHT);
+            if (m_pPlayer->x() + m_playerSpeed <= m_pScene->width() - m_pPlayer->sceneBoundingRect().width())
+                m_pPlayer->setX(m_pPlayer->x() + m_playerSpeed);
         }
-        if (mostRecentKey == Qt::Key_Up && m_pPlayer->y() - m_playerSpeed >= 0) {
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/UpLink_2.gif");
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/UpLink_1.gif");
-            m_pPlayer->setY(m_pPlayer->y() - m_playerSpeed);
+        if (mostRecentKey == Qt::Key_Up) {
+            m_pPlayer->walk(Player::UP);
+            if (m_pPlayer->y() - m_playerSpeed >= 0)
+                m_pPlayer->setY(m_pPlayer->y() - m_playerSpeed);
         }
-        if (mostRecentKey == Qt::Key_Down && m_pPlayer->y() + m_playerSpeed <= m_pScene->height() - m_pPlayer->sceneBoundingRect().height()) {
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/DownLink_2.gif");
-            m_pPlayer->addAnimationFrame(GameFramework::imagesPath() + "JeuZelda/DownLink_1.gif");
-            m_pPlayer->setY(m_pPlayer->y() + m_playerSpeed);
+        if (mostRecentKey == Qt::Key_Down) {
+            m_pPlayer->walk(Player::DOWN);
+            if (m_pPlayer->y() + m_playerSpeed <= m_pScene->height() - m_pPlayer->sceneBoundingRect().height())
+                m_pPlayer->setY(m_pPlayer->y() + m_playerSpeed);
         }
+    } else {
+        m_pPlayer->stopWalking();
     }
     // Oriente l'attaque du joueur en fonction de la touche appuyée (W, A, S ou D)
     if(isWKeyPressed) {
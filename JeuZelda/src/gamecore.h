@@ -17,9 +17,11 @@ class Sprite;
 class Player;
 class EnnemiLeever;
 class EnnemiFactory;
+class EnemyStore;
+class BulletEngine;
 class QGraphicsItem;
 class Projectile;
-class QGraphicsSimpleTextItem;
+class StaticTextItem;
 
 //! \brief Classe qui gère la logique du jeu.
 //!
@@ -48,10 +50,6 @@ public:
         ENDED_LOSE
     };
 
-    enum SpriteDataKey {
-        SPRITE_TYPE_KEY = 0
-    };
-
     explicit GameCore(GameCanvas* pGameCanvas, QObject *parent = nullptr);
     ~GameCore() override;
 
@@ -64,9 +62,12 @@ public:
 
     void tick(long long elapsedTimeInMilliseconds);
     void updatePlayer();
+    void collideBullets();
+    void checkPlayerDeath();
     void restorePlayerOpacity();
 
     int countEnnemies();
+    const EnemyStore* enemyStore() const { return m_pEnemyStore; }
     void generateEnemyWave();
 
     void displayInformation(const QString& rMessage);
@@ -110,6 +111,8 @@ private:
     Player*  m_pPlayer = nullptr;
     EnnemiLeever* m_pEnnemiLeever;
     EnnemiFactory* m_pEnnemifactory;
+    EnemyStore* m_pEnemyStore = nullptr;
+    BulletEngine* m_pBulletEngine = nullptr;
     Sprite* m_pBush1 = nullptr;
     Sprite* m_pBush2 = nullptr;
     Sprite* m_pRock1 = nullptr;
@@ -125,16 +128,16 @@ private:
     bool isAKeyPressed = false;
     bool isSKeyPressed = false;
     bool isDKeyPressed = false;
-    QGraphicsSimpleTextItem* m_pDisplayedInformation;
-    QGraphicsSimpleTextItem* m_pDisplayedNumberWaves;
-    QGraphicsSimpleTextItem* m_pDisplayedLevelInformation;
-    QGraphicsSimpleTextItem* m_pDisplayedtextHeart;
-    QGraphicsSimpleTextItem* m_pDisplayedtextBlueRing;
-    QGraphicsSimpleTextItem* m_pDisplayedtextTriforce;
-    QGraphicsSimpleTextItem* m_pDisplayedtextLeever;
-    QGraphicsSimpleTextItem* m_pDisplayedtextLeeverRouge;
-    QGraphicsSimpleTextItem* m_pDisplayedtextOctopus;
-    QGraphicsSimpleTextItem* m_pDisplayedBestScore;
+    StaticTextItem* m_pDisplayedInformation;
+    StaticTextItem* m_pDisplayedNumberWaves;
+    StaticTextItem* m_pDisplayedLevelInformation;
+    StaticTextItem* m_pDisplayedtextHeart;
+    StaticTextItem* m_pDisplayedtextBlueRing;
+    StaticTextItem* m_pDisplayedtextTriforce;
+    StaticTextItem* m_pDisplayedtextLeever;
+    StaticTextItem* m_pDisplayedtextLeeverRouge;
+    StaticTextItem* m_pDisplayedtextOctopus;
+    StaticTextItem* m_pDisplayedBestScore;
     Sprite* m_pHeart = nullptr;
     Sprite* m_pBlueRing = nullptr;
     Sprite* m_pTriforce = nullptr;
@@ -0,0 +1,180 @@
+/**
+  \file
+  \brief    Définition de la classe GamePools.
+  \date     octobre 2026
+*/
+#include "gamepools.h"
+
+#include <QStringList>
+
+#include "EnnemiLeever.h"
+#include "EnnemiLeeverRouge.h"
+#include "ennemioctopus.h"
+#include "gameclips.h"
+#include "gamecore.h"
+#include "gamescene.h"
+#include "itemdroptickhandler.h"
+#include "player.h"
+#include "projectile.h"
+
+const qreal ROCK_SCALE_FACTOR = 2;
+
+//! Retire le sprite donné de sa scène, s'il en fait partie.
+static void removeFromScene(Sprite* pSprite) {
+    if (pSprite->scene() != nullptr && pSprite->parentScene() != nullptr)
+        pSprite->parentScene()->removeSpriteFromScene(pSprite);
+}
+
+//! Réinitialise un ennemi obtenu d'un réservoir.
+static void resetEnnemy(Ennemy* pEnnemy) {
+    pEnnemy->reset();
+}
+
+//! Retire de sa scène un sprite rendu à son réservoir et stoppe son animation.
+static void retireSprite(Sprite* pSprite) {
+    removeFromScene(pSprite);
+    pSprite->stopAnimation();
+}
+
+//! Construit un objet laissé par un ennemi, qui affiche l'animation donnée.
+static Sprite* createItemDrop(int spriteType, GameClips::ClipId clipId) {
+    Sprite* pItemDrop = new Sprite(GameClips::clip(clipId));
+    pItemDrop->setSpriteType(spriteType);
+    pItemDrop->setScale(GameCore::ITEM_DROP_SCALE_FACTOR);
+    pItemDrop->setTickHandler(new ItemDropTickHandler);
+    return pItemDrop;
+}
+
+//! Réinitialise la durée de vie d'un objet obtenu d'un réservoir.
+static void resetItemDrop(Sprite* pItemDrop) {
+    static_cast<ItemDropTickHandler*>(pItemDrop->tickHandler())->reset();
+}
+
+//! \return le réservoir des Leevers.
+ObjectPool<EnnemiLeever>& GamePools::leevers() {
+    static ObjectPool<EnnemiLeever> s_pool("Leever",
+        []() { return new EnnemiLeever; }, resetEnnemy, retireSprite);
+    return s_pool;
+}
+
+//! \return le réservoir des Leevers rouges.
+ObjectPool<EnnemiLeeverRouge>& GamePools::redLeevers() {
+    static ObjectPool<EnnemiLeeverRouge> s_pool("Leever rouge",
+        []() { return new EnnemiLeeverRouge; }, resetEnnemy, retireSprite);
+    return s_pool;
+}
+
+//! \return le réservoir des Octopus.
+//! Rendre un Octopus rend également son projectile.
+ObjectPool<EnnemiOctopus>& GamePools::octopuses() {
+    static ObjectPool<EnnemiOctopus> s_pool("Octopus",
+        []() { return new EnnemiOctopus; }, resetEnnemy,
+        [](EnnemiOctopus* pOctopus) {
+            pOctopus->removeProjectile();
+            retireSprite(pOctopus);
+        });
+    return s_pool;
+}
+
+//! \return le réservoir des épées lancées par le joueur.
+//! Une épée obtenue doit être lancée avec Projectile::launch().
+ObjectPool<Projectile>& GamePools::swords() {
+    static ObjectPool<Projectile> s_pool("Epée",
+        []() {
+            Projectile* pSword = new Projectile(0, QPointF(1, 0), AssetRegistry::SWORD, nullptr);
+            pSword->setScale(Player::SWORD_SCALE_FACTOR);
+            return pSword;
+        }, nullptr, retireSprite);
+    return s_pool;
+}
+
+//! \return le réservoir des pierres lancées par les Octopus.
+//! Une pierre obtenue doit être lancée avec Projectile::launch().
+ObjectPool<Projectile>& GamePools::rocks() {
+    static ObjectPool<Projectile> s_pool("Pierre",
+        []() {
+            Projectile* pRock = new Projectile(0, QPointF(1, 0), AssetRegistry::ROCK_PROJECTILE, nullptr);
+            pRock->setScale(ROCK_SCALE_FACTOR);
+            return pRock;
+        }, nullptr, retireSprite);
+    return s_pool;
+}
+
+//! \return le réservoir des nuages affichés à la mort d'un ennemi.
+//! Un nuage est automatiquement rendu au réservoir à la fin de son animation.
+ObjectPool<Sprite>& GamePools::clouds() {
+    static ObjectPool<Sprite> s_pool("Nuage",
+        []() {
+            Sprite* pCloud = new Sprite(GameClips::clip(GameClips::CLOUD));
+            pCloud->setScale(Ennemy::CLOUD_SCALE_FACTOR);
+            pCloud->setEmitSignalEndOfAnimationEnabled(true);
+            QObject::connect(pCloud, &Sprite::animationFinished, pCloud, [pCloud]() {
+                GamePools::clouds().release(pCloud);
+            });
+            return pCloud;
+        }, nullptr, retireSprite);
+    return s_pool;
+}
+
+//! \return le réservoir des objets du type donné laissés par les ennemis
+//! (GameCore::HEARTDROP, GameCore::BLUE_RING ou GameCore::TRIFORCE).
+//! Un objet obtenu doit être inscrit à la cadence (Sprite::registerForTick()) une fois
+//! ajouté à sa scène : il est automatiquement rendu au réservoir à la fin de sa durée
+//! de vie (ItemDropTickHandler).
+ObjectPool<Sprite>& GamePools::itemDrops(int spriteType) {
+    static ObjectPool<Sprite> s_heartPool("Coeur",
+        []() { return createItemDrop(GameCore::HEARTDROP, GameClips::HEART_DROP); },
+        resetItemDrop, retireSprite);
+    static ObjectPool<Sprite> s_blueRingPool("Blue ring",
+        []() { return createItemDrop(GameCore::BLUE_RING, GameClips::BLUE_RING_DROP); },
+        resetItemDrop, retireSprite);
+    static ObjectPool<Sprite> s_triforcePool("Triforce",
+        []() { return createItemDrop(GameCore::TRIFORCE, GameClips::TRIFORCE_DROP); },
+        resetItemDrop, retireSprite);
+
+    switch (spriteType) {
+    case GameCore::BLUE_RING: return s_blueRingPool;
+    case GameCore::TRIFORCE:  return s_triforcePool;
+    default:
+        Q_ASSERT(spriteType == GameCore::HEARTDROP);
+        return s_heartPool;
+    }
+}
+
+//! Rend l'objet donné, laissé par un ennemi, au réservoir correspondant à son type.
+void GamePools::releaseItemDrop(Sprite* pItemDrop) {
+    itemDrops(pItemDrop->spriteType()).release(pItemDrop);
+}
+
+//! \return la liste de tous les réservoirs.
+QList<ObjectPoolBase*> GamePools::pools() {
+    return { &leevers(), &redLeevers(), &octopuses(), &swords(), &rocks(), &clouds(),
+             &itemDrops(GameCore::HEARTDROP), &itemDrops(GameCore::BLUE_RING), &itemDrops(GameCore::TRIFORCE) };
+}
+
+//! Détruit les objets disponibles de tous les réservoirs.
+void GamePools::clear() {
+    const QList<ObjectPoolBase*> allPools = pools();
+    for (ObjectPoolBase* pPool : allPools)
+        pPool->clear();
+}
+
+//! \return un tableau de l'occupation de chaque réservoir : objets utilisés, objets
+//! disponibles, plus grand nombre d'objets utilisés simultanément et objets construits.
+QString GamePools::report() {
+    QStringList lines;
+    lines << QString("%1 %2 %3 %4 %5")
+             .arg(QString("Pool"), -12).arg(QString("used"), 6).arg(QString("idle"), 6)
+             .arg(QString("max"), 6).arg(QString("built"), 6);
+
+    const QList<ObjectPoolBase*> allPools = pools();
+    for (const ObjectPoolBase* pPool : allPools) {
+        lines << QString("%1 %2 %3 %4 %5")
+                 .arg(pPool->name(), -12)
+                 .arg(pPool->activeCount(), 6)
+                 .arg(pPool->idleCount(), 6)
+                 .arg(pPool->highWaterMark(), 6)
+                 .arg(pPool->allocationCount(), 6);
+    }
+    return lines.join('\n');
+}
@@ -0,0 +1,59 @@
+/**
+  \file
+  \brief    Déclaration de la classe GamePools.
+  \date     octobre 2026
+*/
+#ifndef GAMEPOOLS_H
+#define GAMEPOOLS_H
+
+#include <QList>
+
+#include "objectpool.h"
+
+class EnnemiLeever;
+class EnnemiLeeverRouge;
+class EnnemiOctopus;
+class Projectile;
+class Sprite;
+
+//! \brief Réservoirs (ObjectPool) des objets créés et détruits en permanence par le jeu.
+//!
+//! Les ennemis, les projectiles (épée du joueur et pierres des Octopus), les nuages
+//! affichés à la mort d'un ennemi et les objets qu'il laisse (coeur, blue ring et
+//! triforce) sont obtenus de ces réservoirs plutôt que construits, et leur sont rendus
+//! plutôt que détruits. Ils sont ainsi recyclés d'une vague à l'autre et d'une partie
+//! à l'autre.
+//!
+//! Rendre un sprite à son réservoir le retire de sa scène. Le réservoir le réinitialise
+//! lorsqu'il est à nouveau obtenu ; il reste à le positionner et à l'ajouter à une scène.
+//!
+//! report() donne l'occupation de chaque réservoir et le plus grand nombre d'objets
+//! utilisés simultanément, ce qui permet par exemple de dimensionner des réservations
+//! (ObjectPool::reserve()). Elle est affichée avec les informations détaillées
+//! (Ctrl+Shift+I) et dans le résumé de la simulation sans affichage mesurée (--profile).
+//!
+//! Les objets disponibles doivent être détruits avec clear() avant la destruction de
+//! QApplication ; GameCore le fait lors de sa destruction.
+class GamePools
+{
+public:
+    static ObjectPool<EnnemiLeever>& leevers();
+    static ObjectPool<EnnemiLeeverRouge>& redLeevers();
+    static ObjectPool<EnnemiOctopus>& octopuses();
+
+    static ObjectPool<Projectile>& swords();
+    static ObjectPool<Projectile>& rocks();
+
+    static ObjectPool<Sprite>& clouds();
+    static ObjectPool<Sprite>& itemDrops(int spriteType);
+    static void releaseItemDrop(Sprite* pItemDrop);
+
+    static QList<ObjectPoolBase*> pools();
+    static void clear();
+    static QString report();
+
+private:
+    GamePools() = delete;
+};
+
+#endif // GAMEPOOLS_H
@@ -0,0 +1,35 @@
+/**
+  \file
+  \brief    Définition de la classe GameRandom.
+  \date     octobre 2026
+*/
+#include "gamerandom.h"
+
+quint64 GameRandom::s_seed = 0;
+RandomStream GameRandom::s_streams[GameRandom::STREAM_COUNT];
+
+//! Change la graine de partie et réinitialise tous les générateurs.
+//! \param seed  Graine de partie.
+void GameRandom::setSeed(quint64 seed) {
+    s_seed = seed;
+    reset();
+}
+
+//! \return la graine de partie.
+quint64 GameRandom::seed() {
+    return s_seed;
+}
+
+//! Remet tous les générateurs dans l'état qui découle de la graine de partie.
+//! La graine de chaque générateur est dérivée de la graine de partie et de son
+//! numéro, afin que les suites produites soient indépendantes.
+void GameRandom::reset() {
+    for (int streamIndex = 0; streamIndex < STREAM_COUNT; streamIndex++)
+        s_streams[streamIndex].seed(s_seed ^ (0xD1B54A32D192ED03ULL * static_cast<quint64>(streamIndex + 1)));
+}
+
+//! \return le générateur du sous-système donné.
+RandomStream& GameRandom::stream(Stream stream) {
+    Q_ASSERT(stream >= 0 && stream < STREAM_COUNT);
+    return s_streams[stream];
+}
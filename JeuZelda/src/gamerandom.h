@@ -0,0 +1,52 @@
+/**
+  \file
+  \brief    Déclaration de la classe GameRandom.
+  \date     octobre 2026
+*/
+#ifndef GAMERANDOM_H
+#define GAMERANDOM_H
+
+#include "randomstream.h"
+
+//! \brief Générateurs pseudo-aléatoires du jeu, un par sous-système.
+//!
+//! Toutes les décisions aléatoires du jeu passent par un générateur (RandomStream)
+//! propre au sous-système concerné (stream()) : position d'apparition des ennemis,
+//! composition des vagues, déplacements des Leevers, attaques des Octopus et objets
+//! laissés par les ennemis.
+//!
+//! Tous les générateurs sont dérivés d'une seule graine de partie (setSeed()). Ainsi,
+//! avec la même graine et les mêmes entrées, deux parties se déroulent de façon
+//! identique. Comme chaque sous-système possède son propre générateur, modifier le
+//! nombre de tirages de l'un ne change pas les tirages des autres.
+//!
+//! reset() remet tous les générateurs dans leur état initial ; GameCore l'appelle
+//! au début de chaque partie.
+//!
+//! Ces générateurs ne doivent être utilisés que depuis le thread du jeu.
+class GameRandom
+{
+public:
+    enum Stream {
+        SPAWN,
+        WAVE,
+        LEEVER_AI,
+        OCTOPUS_AI,
+        ITEM_DROP,
+        STREAM_COUNT
+    };
+
+    static void setSeed(quint64 seed);
+    static quint64 seed();
+    static void reset();
+
+    static RandomStream& stream(Stream stream);
+
+private:
+    GameRandom() = delete;
+
+    static quint64 s_seed;
+    static RandomStream s_streams[STREAM_COUNT];
+};
+
+#endif // GAMERANDOM_H
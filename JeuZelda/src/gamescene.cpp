@@ -6,6 +6,7 @@
 */
 #include "gamescene.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <QApplication>
 #include <QBrush>
@@ -16,9 +17,18 @@
 #include <QPainter>
 #include <QPen>
 
+#include "animationclock.h"
 #include "gamecore.h"
 #include "resources.h"
+#include "spatialhashgrid.h"
+#include "statictextitem.h"
 #include "sprite.h"
+#include "tickprofiler.h"
+#include "timerwheel.h"
+
+// Au-delà de cette distance (en pixels) parcourue en un seul pas de simulation,
+// le déplacement est considéré comme une téléportation et n'est pas interpolé.
+const qreal MAX_INTERPOLATION_DISTANCE = 64.0;
 
 //! Construit la scène de jeu avec une taille par défaut et un fond noir.
 //! \param pParent  Objet propriétaire de cette scène.
@@ -57,6 +67,15 @@ GameScene::~GameScene()  {
 
     delete m_pBackgroundImage;
     m_pBackgroundImage = nullptr;
+
+    delete m_pAnimationClock;
+    m_pAnimationClock = nullptr;
+
+    delete m_pTimerWheel;
+    m_pTimerWheel = nullptr;
+
+    delete m_pSpatialGrid;
+    m_pSpatialGrid = nullptr;
 }
 
 //! Ajoute le sprite à la scène.
@@ -68,6 +87,8 @@ void GameScene::addSpriteToScene(Sprite* pSprite)
 
     this->addItem(pSprite);
     pSprite->setParentScene(this);
+    addSpriteToTypeRegistry(pSprite);
+    m_pSpatialGrid->insert(pSprite);
 
     connect(pSprite, &Sprite::spriteDestroyed, this, &GameScene::onSpriteDestroyed);
     emit spriteAddedToScene(pSprite);
@@ -89,50 +110,75 @@ void GameScene::addSpriteToScene(Sprite* pSprite, double posX, double posY)
 //! \param pSprite Pointeur sur le sprite à enlever de la scène.
 void GameScene::removeSpriteFromScene(Sprite* pSprite)
 {
+    Q_ASSERT(pSprite != nullptr);
+
     removeItem(pSprite);
+    removeSpriteFromTypeRegistry(pSprite, pSprite->spriteType());
+    m_pSpatialGrid->remove(pSprite);
+    removeSpriteFromInterpolation(pSprite);
+    pSprite->clearRenderOffset();
 
     disconnect(pSprite, &Sprite::spriteDestroyed, this, &GameScene::onSpriteDestroyed);
 
     m_registeredForTickSpriteList.removeAll(pSprite);
+    m_pAnimationClock->unregisterSprite(pSprite);
+    m_pTimerWheel->cancelAll(pSprite);
 
     emit spriteRemovedFromScene(pSprite);
 }
 
 //! Construit la liste de tous les sprites en collision avec le sprite donné en
 //! paramètre.
-//! Si la scène contient de nombreux sprites, cette méthode peut prendre du temps.
+//! Seuls les sprites visibles proches (selon la grille spatiale) voient leur forme
+//! testée. La liste est triée du sprite le plus en avant au plus en arrière.
 //! \param pSprite Sprite pour lequel les collisions doivent être vérifiées.
 //! \return une liste de sprites en collision. Si aucun autre sprite ne collisionne
 //! le sprite donné, la liste retournée est vide.
 QList<Sprite*> GameScene::collidingSprites(const Sprite* pSprite) const {
+    TraceZone zone("collidingSprites");
     QList<Sprite*> spriteList;
-    const auto collidingItems = pSprite->collidingItems();
-    for(QGraphicsItem* pItem : collidingItems) {
-        if (pItem->type() == Sprite::SpriteItemType)
-            spriteList << static_cast<Sprite*>(pItem);
+
+    if (!m_pSpatialGrid->contains(pSprite)) {
+        // Le sprite ne fait pas partie de cette scène (par exemple un élément enfant) :
+        // on se rabat sur l'index de Qt.
+        const auto collidingItems = pSprite->collidingItems();
+        for(QGraphicsItem* pItem : collidingItems) {
+            if (pItem->type() == Sprite::SpriteItemType)
+                spriteList << static_cast<Sprite*>(pItem);
+        }
+        return spriteList;
+    }
+
+    m_collisionCandidates.resize(0);
+    m_pSpatialGrid->query(pSprite->m_spatialGridBounds, m_collisionCandidates);
+    for(Sprite* pCandidate : std::as_const(m_collisionCandidates)) {
+        if (pCandidate != pSprite && pCandidate->isVisible() && pSprite->collidesWithItem(pCandidate))
+            spriteList << pCandidate;
     }
+
+    sortByDescendingStackingOrder(spriteList);
     return spriteList;
 }
 
-//! Construit la liste de tous les sprites en collision avec le rectangle donné
-//! en paramètre.
-//! Si la scène contient de nombreux sprites, cette méthode peut prendre du temps.
+//! Construit la liste de tous les sprites dont le rectangle englobant intersecte
+//! le rectangle donné en paramètre.
+//! La liste est triée du sprite le plus en avant au plus en arrière.
 //! \param rRect Rectangle avec lequel il faut tester les collisions.
 //! \return une liste de sprites en collision.
 QList<Sprite*> GameScene::collidingSprites(const QRectF &rRect) const  {
-    QList<Sprite*> collidingSpriteList;
-    for(Sprite* pSprite : sprites())  {
-        QRectF globalBBox = pSprite->globalBoundingRect();
-        if (globalBBox.intersects(rRect)) {
-            collidingSpriteList << pSprite;
-        }
-    }
+    TraceZone zone("collidingSprites(rect)");
+    m_collisionCandidates.resize(0);
+    m_pSpatialGrid->query(rRect, m_collisionCandidates);
+
+    QList<Sprite*> collidingSpriteList(m_collisionCandidates.cbegin(), m_collisionCandidates.cend());
+    sortByDescendingStackingOrder(collidingSpriteList);
     return collidingSpriteList;
 }
 
 //! Construit la liste de tous les sprites en collision avec la forme donnée
 //! en paramètre.
-//! Si la scène contient de nombreux sprites, cette méthode peut prendre du temps.
+//! Seule la forme des sprites dont le rectangle englobant intersecte celui de la
+//! forme donnée est testée.
 //! \param rShape Forme avec laquelle il faut tester les collisions.
 //! \return une liste de sprites en collision.
 QList<Sprite*> GameScene::collidingSprites(const QPainterPath& rShape) const {
@@ -159,6 +205,28 @@ QList<Sprite*> GameScene::sprites() const  {
     return spriteList;
 }
 
+//! Retourne la liste des sprites de cette scène auxquels le type donné a été
+//! attribué (Sprite::setSpriteType()).
+//! Cette liste est tenue à jour par la scène : l'obtenir ne nécessite ni parcours
+//! des éléments de la scène, ni allocation.
+//! L'ordre des sprites de la liste n'est pas garanti.
+//! Si la liste doit être parcourue alors que des sprites de ce type sont ajoutés
+//! ou retirés, il faut travailler sur une copie.
+//! \param spriteType  Type des sprites recherchés.
+//! \return une référence sur la liste des sprites de ce type (éventuellement vide).
+const QVector<Sprite*>& GameScene::spritesOfType(int spriteType) const {
+    static const QVector<Sprite*> s_emptySpriteList;
+
+    auto it = m_spritesByType.constFind(spriteType);
+    return it != m_spritesByType.constEnd() ? it.value() : s_emptySpriteList;
+}
+
+//! \param spriteType  Type des sprites à compter.
+//! \return le nombre de sprites de cette scène auxquels le type donné a été attribué.
+int GameScene::spriteCount(int spriteType) const {
+    return static_cast<int>(spritesOfType(spriteType).count());
+}
+
 //! Récupère le sprite visible le plus en avant se trouvant à la position donnée.
 //! \return un pointeur sur le sprite trouvé, ou null si aucun sprite ne se trouve à cette position.
 Sprite* GameScene::spriteAt(const QPointF& rPosition) const {
@@ -177,10 +245,12 @@ Sprite* GameScene::spriteAt(const QPointF& rPosition) const {
 //! \param rText            Texte à afficher.
 //! \param size             Taille (en pixels) du texte.
 //! \param color            Couleur du texte.
-//! \return un pointeur sur l'élément graphique textuel.
+//! \return un pointeur sur l'élément graphique textuel, dont la mise en page est
+//! conservée tant que son texte et sa police ne changent pas (voir StaticTextItem).
 //!
-QGraphicsSimpleTextItem* GameScene::createText(QPointF initialPosition, const QString& rText, int size, QColor color) {
-    QGraphicsSimpleTextItem* pText = this->addSimpleText(rText);
+StaticTextItem* GameScene::createText(QPointF initialPosition, const QString& rText, int size, QColor color) {
+    StaticTextItem* pText = new StaticTextItem(rText);
+    this->addItem(pText);
     pText->setPos(initialPosition);
     QFont textFont = pText->font();
     textFont.setPixelSize(size);
@@ -273,15 +343,92 @@ void GameScene::centerViewOn(QPointF pos) {
     views().at(0)->centerOn(pos);
 }
 
+//! \return l'horloge qui cadence les animations des sprites de cette scène.
+AnimationClock* GameScene::animationClock() const {
+    return m_pAnimationClock;
+}
+
+//! \return la roue de minuteurs de cette scène, qui avance à chaque tick (voir TimerWheel).
+TimerWheel* GameScene::timerWheel() const {
+    return m_pTimerWheel;
+}
+
+//! Trie la liste de sprites donnée selon l'ordre d'empilement décroissant (le
+//! sprite le plus en avant en premier), comme le fait QGraphicsScene::collidingItems() :
+//! par ordre z décroissant puis, à ordre z égal, du dernier au premier ajouté à la scène.
+void GameScene::sortByDescendingStackingOrder(QList<Sprite*>& rSpriteList) {
+    std::sort(rSpriteList.begin(), rSpriteList.end(), [](const Sprite* pA, const Sprite* pB) {
+        if (pA->zValue() != pB->zValue())
+            return pA->zValue() > pB->zValue();
+        return pA->m_spatialGridSerial > pB->m_spatialGridSerial;
+    });
+}
+
+//! Change la taille des cellules de la grille spatiale utilisée pour la détection
+//! de collisions.
+//! Idéalement, cette taille est du même ordre de grandeur que celle des sprites.
+//! \param cellSize  Taille (en pixels) du côté d'une cellule.
+void GameScene::setSpatialGridCellSize(int cellSize) {
+    m_pSpatialGrid->setCellSize(cellSize);
+}
+
+//! \return la taille (en pixels) du côté d'une cellule de la grille spatiale.
+int GameScene::spatialGridCellSize() const {
+    return m_pSpatialGrid->cellSize();
+}
+
 //! Cadence.
+//! Appelle la fonction tick() des sprites abonnés, puis fait avancer les animations.
 //! \param elapsedTimeInMilliseconds  Temps écoulé depuis le tick précédent.
 void GameScene::tick(long long elapsedTimeInMilliseconds) {
-    auto spriteListCopy = m_registeredForTickSpriteList; // On travaille sur une copie au cas où
-                                        // la liste originale serait modifiée
-                                        // lors de l'appel de tick auprès d'un sprite.
-    for(Sprite* pSprite : spriteListCopy) {
-        pSprite->tick(elapsedTimeInMilliseconds);
+    {
+        ProfileZone zone(TickProfiler::SCENE);
+        auto spriteListCopy = m_registeredForTickSpriteList; // On travaille sur une copie au cas où
+                                            // la liste originale serait modifiée
+                                            // lors de l'appel de tick auprès d'un sprite.
+        for(Sprite* pSprite : spriteListCopy) {
+            pSprite->tick(elapsedTimeInMilliseconds);
+        }
+
+        m_pTimerWheel->advance(elapsedTimeInMilliseconds);
+    }
+
+    ProfileZone zone(TickProfiler::ANIMATION);
+    m_pAnimationClock->advance(elapsedTimeInMilliseconds);
+}
+
+//! Prépare un nouveau pas de simulation (voir \ref scene_interpolation) : les sprites
+//! sont affichés à leur position réelle et les déplacements du pas précédent sont oubliés.
+//! Appelé par GameCanvas avant chaque tick.
+void GameScene::beginSimulationStep() {
+    for (Sprite* pSprite : std::as_const(m_movedSprites)) {
+        pSprite->clearRenderOffset();
+        pSprite->m_interpolationSlot = -1;
     }
+    m_movedSprites.clear();
+}
+
+//! Affiche les sprites déplacés lors du dernier pas de simulation entre leur position
+//! de départ et leur position actuelle (voir \ref scene_interpolation).
+//! Un sprite qui a parcouru une trop grande distance (téléportation) est affiché à sa
+//! position actuelle.
+//! \param alpha  Part du pas de simulation suivant déjà écoulée, entre 0 (position de
+//!               départ) et 1 (position actuelle).
+void GameScene::interpolateRendering(qreal alpha) {
+    const qreal remainingPart = 1.0 - qBound(0.0, alpha, 1.0);
+    for (Sprite* pSprite : std::as_const(m_movedSprites)) {
+        const QPointF displacement = pSprite->m_previousSimulationPos - pSprite->pos();
+        if (displacement.isNull() || displacement.manhattanLength() > MAX_INTERPOLATION_DISTANCE)
+            pSprite->clearRenderOffset();
+        else
+            pSprite->setRenderOffset(displacement * remainingPart);
+    }
+}
+
+//! Affiche tous les sprites à leur position réelle, sans interpolation.
+void GameScene::clearRenderInterpolation() {
+    for (Sprite* pSprite : std::as_const(m_movedSprites))
+        pSprite->clearRenderOffset();
 }
 
 //! Dessine le fond d'écran de la scène.
@@ -299,6 +446,9 @@ void GameScene::drawBackground(QPainter* pPainter, const QRectF& rRect)  {
 //! Initialise la scène
 void GameScene::init() {
     m_pBackgroundImage = nullptr;
+    m_pAnimationClock = new AnimationClock;
+    m_pTimerWheel = new TimerWheel;
+    m_pSpatialGrid = new SpatialHashGrid;
 
     this->setBackgroundBrush(QBrush(Qt::black));
     //setBackgroundImage(QImage(GameFramework::imagesPath("demo/landscape_background.jpg"));
@@ -309,7 +459,79 @@ void GameScene::init() {
 
 }
 
-//! Retire de la liste des sprite le sprite qui va être détruit.
+//! Appelé par le sprite donné juste avant qu'il ne soit déplacé.
+//! Lors de son premier déplacement du pas de simulation, sa position de départ est
+//! mémorisée pour l'interpolation de l'affichage (voir \ref scene_interpolation).
+void GameScene::onSpriteAboutToMove(Sprite* pSprite) {
+    pSprite->clearRenderOffset();
+
+    if (pSprite->m_interpolationSlot >= 0 || pSprite->scene() != this)
+        return;
+
+    pSprite->m_previousSimulationPos = pSprite->pos();
+    pSprite->m_interpolationSlot = static_cast<int>(m_movedSprites.count());
+    m_movedSprites.append(pSprite);
+}
+
+//! Retire le sprite donné de la liste des sprites déplacés lors du pas de simulation.
+//! Le dernier sprite de la liste prend sa place, afin que le retrait se fasse
+//! en temps constant.
+void GameScene::removeSpriteFromInterpolation(Sprite* pSprite) {
+    int slot = pSprite->m_interpolationSlot;
+    if (slot < 0)
+        return;
+
+    Q_ASSERT(slot < m_movedSprites.count() && m_movedSprites[slot] == pSprite);
+    Sprite* pLastSprite = m_movedSprites.takeLast();
+    if (pLastSprite != pSprite) {
+        m_movedSprites[slot] = pLastSprite;
+        pLastSprite->m_interpolationSlot = slot;
+    }
+    pSprite->m_interpolationSlot = -1;
+}
+
+//! Inscrit le sprite donné dans la liste des sprites de son type.
+//! Un sprite sans type (-1) n'est inscrit dans aucune liste.
+void GameScene::addSpriteToTypeRegistry(Sprite* pSprite) {
+    if (pSprite->spriteType() < 0 || pSprite->m_typeRegistrySlot >= 0)
+        return;
+
+    QVector<Sprite*>& rSpriteList = m_spritesByType[pSprite->spriteType()];
+    pSprite->m_typeRegistrySlot = static_cast<int>(rSpriteList.count());
+    rSpriteList.append(pSprite);
+}
+
+//! Retire le sprite donné de la liste des sprites du type donné.
+//! Le dernier sprite de la liste prend sa place, afin que le retrait se fasse
+//! en temps constant.
+void GameScene::removeSpriteFromTypeRegistry(Sprite* pSprite, int spriteType) {
+    int slot = pSprite->m_typeRegistrySlot;
+    if (slot < 0)
+        return;
+
+    QVector<Sprite*>& rSpriteList = m_spritesByType[spriteType];
+    Q_ASSERT(slot < rSpriteList.count() && rSpriteList[slot] == pSprite);
+
+    Sprite* pLastSprite = rSpriteList.last();
+    rSpriteList[slot] = pLastSprite;
+    pLastSprite->m_typeRegistrySlot = slot;
+    rSpriteList.removeLast();
+
+    pSprite->m_typeRegistrySlot = -1;
+}
+
+//! Le type du sprite donné a changé : il passe de la liste de son ancien type
+//! à celle de son nouveau type.
+void GameScene::onSpriteTypeChanged(Sprite* pSprite, int previousType) {
+    removeSpriteFromTypeRegistry(pSprite, previousType);
+    addSpriteToTypeRegistry(pSprite);
+}
+
+//! Retire des listes de la scène le sprite qui va être détruit.
 void GameScene::onSpriteDestroyed(Sprite* pSprite) {
     m_registeredForTickSpriteList.removeAll(pSprite);
+    m_pTimerWheel->cancelAll(pSprite);
+    removeSpriteFromTypeRegistry(pSprite, pSprite->spriteType());
+    m_pSpatialGrid->remove(pSprite);
+    removeSpriteFromInterpolation(pSprite);
 }
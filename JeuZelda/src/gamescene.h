@@ -10,9 +10,14 @@
 #include "gamecanvas.h"
 
 #include <QGraphicsScene>
+#include <QHash>
+#include <QVector>
 
+class AnimationClock;
+class SpatialHashGrid;
 class Sprite;
-class QGraphicsSimpleTextItem;
+class StaticTextItem;
+class TimerWheel;
 class QPainter;
 
 //! \brief Représente l'espace 2D du jeu.
@@ -25,6 +30,7 @@ class QPainter;
 //! - Gestion de sprites (Sprite) avec la méthode addSpriteToScene()
 //! - Détection de collisions avec la méthode collidingSprites()
 //! - Détection du sprite à une position donnée avec spriteAt()
+//! - Accès direct aux sprites d'un type donné (Sprite::setSpriteType()) avec spritesOfType() et spriteCount()
 //! - Affichage de textes avec la méthode createText()
 //!
 //! Cette classe ne gère pas la logique du jeu.
@@ -35,6 +41,26 @@ class QPainter;
 //!
 //! La méthode unregisterSpriteFromTick() permet de désabonner un sprite à la cadence.
 //!
+//! Lors de chaque tick, la scène fait également avancer son horloge d'animation
+//! (animationClock()), qui cadence les animations des sprites qu'elle contient, et sa
+//! roue de minuteurs (timerWheel()), qui déclenche les effets de jeu différés. Les
+//! minuteurs d'un sprite sont annulés lorsqu'il quitte la scène ou est détruit.
+//!
+//! Les sprites de la scène sont référencés dans une grille de hachage spatiale
+//! (SpatialHashGrid), tenue à jour au fil de leurs déplacements. Toutes les méthodes
+//! collidingSprites() l'interrogent, ce qui limite les tests de collision aux seuls
+//! sprites proches. La taille des cellules de la grille peut être adaptée à la taille
+//! des sprites de la scène avec setSpatialGridCellSize().
+//!
+//! \section scene_interpolation Interpolation de l'affichage
+//! La simulation avance par pas de temps fixes (voir GameCanvas), généralement moins
+//! souvent que l'affichage n'est rafraîchi. Avant chaque pas (beginSimulationStep()),
+//! la scène oublie les déplacements du pas précédent ; durant le pas, elle mémorise la
+//! position de départ de chaque sprite déplacé. interpolateRendering() affiche ensuite
+//! ces sprites entre leur position de départ et leur position actuelle, selon la part
+//! du pas suivant déjà écoulée. Seul l'affichage est concerné : la position des sprites
+//! (et donc la détection de collisions) reste celle de la simulation.
+//!
 //! Les méthodes isInsideScene() permettent de savoir si un sprite ou un rectangle (QRectF) se trouvent complètement à l'intérieur de la scène.
 //!
 //! Les méthodes centerViewOn() permettent de s'assurer, lorsque la scène est plus vaste que la partie affichée par la vue, que le sprite
@@ -58,9 +84,11 @@ public:
     QList<Sprite*> collidingSprites(const QRectF& rRect) const;
     QList<Sprite*> collidingSprites(const QPainterPath& rShape) const;
     QList<Sprite*> sprites() const;
+    const QVector<Sprite*>& spritesOfType(int spriteType) const;
+    int spriteCount(int spriteType) const;
     Sprite* spriteAt(const QPointF& rPosition) const;
 
-    QGraphicsSimpleTextItem* createText(QPointF initialPosition, const QString& rText, int size = 10, QColor color=Qt::white);
+    StaticTextItem* createText(QPointF initialPosition, const QString& rText, int size = 10, QColor color=Qt::white);
 
     void setBackgroundImage(const QImage& rImage);
     void setBackgroundColor(QColor color);
@@ -80,8 +108,18 @@ public:
     void centerViewOn(const Sprite* pSprite);
     void centerViewOn(QPointF pos);
 
+    AnimationClock* animationClock() const;
+    TimerWheel* timerWheel() const;
+
+    void setSpatialGridCellSize(int cellSize);
+    int spatialGridCellSize() const;
+
     virtual void tick(long long elapsedTimeInMilliseconds);
 
+    void beginSimulationStep();
+    void interpolateRendering(qreal alpha);
+    void clearRenderInterpolation();
+
 signals:
     void spriteAddedToScene(Sprite* pSprite);
     void spriteRemovedFromScene(Sprite* pSprite);
@@ -90,6 +128,8 @@ protected:
     virtual void drawBackground(QPainter* pPainter, const QRectF& rRect) override;
 
 private:
+    friend class Sprite;
+
     // Seul GameCanvas est autorisé à instancier un GameScene, afin de garantir que
     // l'instanciation soit faite correctement.
     friend GameScene* GameCanvas::createScene();
@@ -102,8 +142,22 @@ private:
 
     void init();
 
+    void addSpriteToTypeRegistry(Sprite* pSprite);
+    void removeSpriteFromTypeRegistry(Sprite* pSprite, int spriteType);
+    void onSpriteTypeChanged(Sprite* pSprite, int previousType);
+    void onSpriteAboutToMove(Sprite* pSprite);
+    void removeSpriteFromInterpolation(Sprite* pSprite);
+
+    static void sortByDescendingStackingOrder(QList<Sprite*>& rSpriteList);
+
     QImage* m_pBackgroundImage;
+    AnimationClock* m_pAnimationClock;
+    TimerWheel* m_pTimerWheel;
+    SpatialHashGrid* m_pSpatialGrid;
+    mutable QVector<Sprite*> m_collisionCandidates;
     QList<Sprite*> m_registeredForTickSpriteList;
+    QHash<int, QVector<Sprite*>> m_spritesByType;
+    QVector<Sprite*> m_movedSprites;
 
 private slots:
     void onSpriteDestroyed(Sprite* pSprite);
@@ -9,6 +9,9 @@
 #include <QDebug>
 #include <QMouseEvent>
 
+#include "startuptimer.h"
+#include "tickprofiler.h"
+
 //! Construit une fenêtre de visualisation de la scène de jeu.
 //! \param pParent  Widget parent.
 GameView::GameView(QWidget* pParent) : QGraphicsView(pParent) {
@@ -91,6 +94,19 @@ void GameView::resizeEvent(QResizeEvent* pEvent) {
     updateSceneDisplaySize();
 }
 
+//! Dessine la vue, en mesurant la durée du dessin (phase TickProfiler::PAINT), qui est
+//! échantillonnée à chaque image, indépendamment des ticks.
+//! Le premier dessin d'une scène marque la fin du démarrage (voir StartupTimer).
+void GameView::paintEvent(QPaintEvent* pEvent) {
+    {
+        ProfileZone zone(TickProfiler::PAINT);
+        QGraphicsView::paintEvent(pEvent);
+    }
+    TickProfiler::commitFrame();
+    if (scene() != nullptr)
+        StartupTimer::mark(StartupTimer::FIRST_FRAME_PAINTED);
+}
+
 //! Dessine le HUD (s'il existe) au premier plan.
 //! Par défaut, la scène du HUD est rendue de sorte qu'elle utilise la surface d'affichage
 //! de cette vue (viewport()->rect()). Il est possible de changer ce comportement, par
@@ -106,6 +122,7 @@ void GameView::drawForeground(QPainter* pPainter, const QRectF& rRect) {
     // viewport, il faut annuler toute transformation du painter, puis les
     // rétablir pour le reste des opérations de dessin.
     if (m_pHudScene) {
+        TraceZone zone("HUD");
         // Ici, il faudrait peut-être tenir compte du flag "fitToScreen" pour
         // ne pas désactiver les transformations s'il est enclenché.
         pPainter->save();
@@ -0,0 +1,198 @@
+/**
+  \file
+  \brief    Définition de la classe HeadlessRunner.
+  \date     octobre 2026
+*/
+#include "headlessrunner.h"
+
+#include <algorithm>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMetaEnum>
+#include <QRegularExpression>
+#include <QTextStream>
+
+#include "assetcache.h"
+#include "gamecanvas.h"
+#include "gamecore.h"
+#include "gamepools.h"
+#include "gamescene.h"
+#include "tickprofiler.h"
+
+const int UNKNOWN_KEY = -1;
+
+//! Construit un exécuteur avec le nombre de ticks et la durée de tick par défaut.
+HeadlessRunner::HeadlessRunner() {
+    m_tickCount = DEFAULT_TICK_COUNT;
+    m_tickDuration = DEFAULT_TICK_DURATION;
+    m_profilingEnabled = false;
+}
+
+//! Charge le script des touches à simuler.
+//! \param rScriptPath  Chemin du fichier de script.
+//! \return un booléen à faux si le fichier ne peut pas être lu ou contient une erreur.
+bool HeadlessRunner::loadScript(const QString& rScriptPath) {
+    QFile scriptFile(rScriptPath);
+    if (!scriptFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Script introuvable :" << rScriptPath;
+        return false;
+    }
+
+    QList<ScriptedKey> script;
+    QTextStream stream(&scriptFile);
+    int lineNumber = 0;
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        lineNumber++;
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        const QStringList fields = line.split(QRegularExpression("\\s+"));
+        bool isTickValid = false;
+        const int tick = fields.value(0).toInt(&isTickValid);
+        const QString action = fields.value(1);
+        const int key = keyFromName(fields.value(2));
+
+        if (fields.count() != 3 || !isTickValid || tick < 0 || key == UNKNOWN_KEY
+                || (action != "press" && action != "release" && action != "tap")) {
+            qWarning() << "Ligne" << lineNumber << "du script invalide :" << line;
+            return false;
+        }
+
+        if (action == "tap") {
+            script << ScriptedKey { tick, key, true } << ScriptedKey { tick + 1, key, false };
+        } else {
+            script << ScriptedKey { tick, key, action == "press" };
+        }
+    }
+
+    // L'ordre du fichier est préservé pour les touches d'un même tick.
+    std::stable_sort(script.begin(), script.end(), [](const ScriptedKey& rA, const ScriptedKey& rB) {
+        return rA.tick < rB.tick;
+    });
+    m_script = script;
+    return true;
+}
+
+//! Change le nombre de ticks à simuler.
+void HeadlessRunner::setTickCount(int tickCount) {
+    m_tickCount = qMax(0, tickCount);
+}
+
+//! \return le nombre de ticks à simuler.
+int HeadlessRunner::tickCount() const {
+    return m_tickCount;
+}
+
+//! Change le temps écoulé (en millisecondes) transmis à chaque tick.
+void HeadlessRunner::setTickDuration(int tickDuration) {
+    m_tickDuration = qMax(1, tickDuration);
+}
+
+//! \return le temps écoulé (en millisecondes) transmis à chaque tick.
+int HeadlessRunner::tickDuration() const {
+    return m_tickDuration;
+}
+
+//! Change le fichier dans lequel les entrées sont enregistrées (vide : pas d'enregistrement).
+void HeadlessRunner::setRecordPath(const QString& rRecordPath) {
+    m_recordPath = rRecordPath;
+}
+
+//! Change l'enregistrement à rejouer (vide : pas de rejeu).
+void HeadlessRunner::setReplayPath(const QString& rReplayPath) {
+    m_replayPath = rReplayPath;
+}
+
+//! Active ou désactive la mesure des phases du tick (TickProfiler) pendant la simulation.
+void HeadlessRunner::setProfilingEnabled(bool profilingEnabled) {
+    m_profilingEnabled = profilingEnabled;
+}
+
+//! Crée le jeu, simule tous les ticks puis écrit un résumé dans la sortie de log.
+//! \return le code de sortie du programme.
+int HeadlessRunner::run() {
+    QList<ScriptedKey> script = m_script;
+    if (script.isEmpty())
+        script << ScriptedKey { 0, Qt::Key_1, true } << ScriptedKey { 1, Qt::Key_1, false };
+
+    GameCanvas canvas;
+
+    // Le rejeu doit démarrer avant la création de GameCore, qui initialise les
+    // générateurs pseudo-aléatoires avec la graine de l'enregistrement.
+    const bool isReplay = !m_replayPath.isEmpty();
+    if (isReplay && !canvas.startReplay(m_replayPath))
+        return 1;
+    if (!m_recordPath.isEmpty() && !canvas.startRecording(m_recordPath))
+        return 1;
+
+    // GameCore est créé par GameCanvas depuis la boucle d'événements.
+    QCoreApplication::processEvents();
+    if (canvas.currentScene() == nullptr) {
+        qCritical() << "Le jeu n'a pas pu être initialisé.";
+        return 1;
+    }
+
+    TickProfiler::setEnabled(m_profilingEnabled);
+
+    int scriptIndex = 0;
+    int simulatedTickCount = 0;
+    QElapsedTimer wallClock;
+    wallClock.start();
+
+    int tick = 0;
+    for (; isReplay ? canvas.isReplaying() : tick < m_tickCount; tick++) {
+        while (scriptIndex < script.count() && script[scriptIndex].tick <= tick) {
+            const ScriptedKey& rScriptedKey = script[scriptIndex];
+            if (rScriptedKey.pressed)
+                canvas.simulateKeyPress(rScriptedKey.key);
+            else
+                canvas.simulateKeyRelease(rScriptedKey.key);
+            scriptIndex++;
+        }
+
+        // Si le jeu a stoppé la cadence (pause, fin de partie), le tick n'a pas lieu,
+        // mais le script continue d'être joué (par exemple pour relancer la partie).
+        // Pendant le rejeu, c'est l'enregistrement qui fait avancer la partie.
+        if (canvas.isTicking() || canvas.isReplaying()) {
+            canvas.simulateTick(m_tickDuration);
+            simulatedTickCount++;
+        }
+
+        QCoreApplication::processEvents();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    }
+
+    const qint64 wallTime = qMax<qint64>(1, wallClock.elapsed());
+    GameScene* pScene = canvas.currentScene();
+
+    qInfo().noquote() << QString("Simulation sans affichage : %1 ticks simulés sur %2 (%3 ms par tick)")
+                         .arg(simulatedTickCount).arg(tick).arg(m_tickDuration);
+    qInfo().noquote() << QString("Durée : %1 ms, soit %2 ticks par seconde")
+                         .arg(wallTime).arg(simulatedTickCount * 1000.0 / wallTime, 0, 'f', 1);
+    qInfo().noquote() << QString("Sprites sur la scène : %1, dont %2 ennemis")
+                         .arg(pScene->sprites().count()).arg(pScene->spriteCount(GameCore::ENNEMI));
+    if (m_profilingEnabled) {
+        qInfo().noquote() << QString("Cache d'images : %1 hit(s), %2 miss(es)")
+                             .arg(AssetCache::hitCount()).arg(AssetCache::missCount());
+        qInfo().noquote() << GamePools::report();
+        qInfo().noquote() << TickProfiler::report();
+        TickProfiler::setEnabled(false);
+    }
+
+    return 0;
+}
+
+//! \return le code de la touche dont le nom est donné (par exemple `Left` ou
+//! `Key_Left`), ou UNKNOWN_KEY si le nom est inconnu.
+int HeadlessRunner::keyFromName(const QString& rKeyName) {
+    if (rKeyName.isEmpty())
+        return UNKNOWN_KEY;
+
+    const QString qtKeyName = rKeyName.startsWith("Key_") ? rKeyName : "Key_" + rKeyName;
+    bool isKeyValid = false;
+    const int key = QMetaEnum::fromType<Qt::Key>().keyToValue(qtKeyName.toLatin1().constData(), &isKeyValid);
+    return isKeyValid ? key : UNKNOWN_KEY;
+}
@@ -0,0 +1,84 @@
+/**
+  \file
+  \brief    Déclaration de la classe HeadlessRunner.
+  \date     octobre 2026
+*/
+#ifndef HEADLESSRUNNER_H
+#define HEADLESSRUNNER_H
+
+#include <QList>
+#include <QString>
+
+//! \brief Fait tourner le jeu sans affichage, aussi vite que possible.
+//!
+//! HeadlessRunner crée un GameCanvas sans vue (voir \ref canvas_headless), qui
+//! crée lui-même GameCore et ses scènes comme d'habitude. Les ticks sont ensuite
+//! produits les uns après les autres, sans attendre, avec un temps écoulé
+//! synthétique constant (setTickDuration()). Cela permet de faire de longues
+//! simulations et des mesures de performance sur une machine sans écran.
+//!
+//! Les touches du clavier sont simulées selon un script (loadScript()), dont chaque
+//! ligne a la forme suivante :
+//!
+//!     <numéro du tick> press|release|tap <touche>
+//!
+//! La touche est le nom d'une constante Qt::Key, avec ou sans le préfixe `Key_`
+//! (par exemple `Left`, `Space` ou `1`). L'action `tap` appuie sur la touche au
+//! tick donné et la relâche au tick suivant. Les lignes vides et celles commençant
+//! par `#` sont ignorées.
+//!
+//! Si aucun script n'est chargé, la touche `1` est tapée au premier tick, ce qui
+//! démarre le premier niveau.
+//!
+//! Les entrées peuvent être enregistrées (setRecordPath()) ou un enregistrement rejoué
+//! (setReplayPath(), voir \ref canvas_replay). Pendant le rejeu, le script est ignoré
+//! et la simulation dure jusqu'à la fin de l'enregistrement, quel que soit tickCount().
+//!
+//! Avec setProfilingEnabled(), la durée de chaque phase du tick est mesurée (TickProfiler)
+//! et ses percentiles sont ajoutés au résumé, avec l'efficacité du cache d'images (AssetCache)
+//! et l'occupation des réservoirs d'objets (GamePools).
+//!
+//! Entre deux ticks, les événements en attente sont traités (destructions différées
+//! par deleteLater() et minuteries), comme ils le seraient par la boucle d'événements.
+//!
+//! Ce mode est lancé par l'option `--headless` de la ligne de commande.
+class HeadlessRunner
+{
+public:
+    static const int DEFAULT_TICK_COUNT = 3000;
+    static const int DEFAULT_TICK_DURATION = 20;
+
+    HeadlessRunner();
+
+    bool loadScript(const QString& rScriptPath);
+
+    void setTickCount(int tickCount);
+    int tickCount() const;
+
+    void setTickDuration(int tickDuration);
+    int tickDuration() const;
+
+    void setRecordPath(const QString& rRecordPath);
+    void setReplayPath(const QString& rReplayPath);
+    void setProfilingEnabled(bool profilingEnabled);
+
+    int run();
+
+private:
+    struct ScriptedKey {
+        int tick;
+        int key;
+        bool pressed;
+    };
+
+    static int keyFromName(const QString& rKeyName);
+
+    QList<ScriptedKey> m_script;
+    int m_tickCount;
+    int m_tickDuration;
+    QString m_recordPath;
+    QString m_replayPath;
+    bool m_profilingEnabled;
+};
+
+#endif // HEADLESSRUNNER_H
@@ -0,0 +1,187 @@
+/**
+  \file
+  \brief    Définition des classes InputRecorder et InputReplayer.
+  \date     octobre 2026
+*/
+#include "inputrecording.h"
+
+#include <QDebug>
+
+const char InputRecorder::FILE_MAGIC[4] = { 'Z', 'F', 'I', 'R' };
+
+const int HEADER_SIZE = 4 + 1 + 8;
+const int FLUSH_THRESHOLD = 4096;
+
+//! Construit un enregistreur inactif.
+InputRecorder::InputRecorder() {
+
+}
+
+//! Destructeur : termine l'enregistrement en cours.
+InputRecorder::~InputRecorder() {
+    stop();
+}
+
+//! Démarre l'enregistrement dans le fichier donné, qui est écrasé s'il existe.
+//! \param rFilePath  Chemin du fichier d'enregistrement.
+//! \param seed       Graine de partie, mémorisée dans l'en-tête.
+//! \return un booléen à faux si le fichier ne peut pas être créé.
+bool InputRecorder::start(const QString& rFilePath, quint64 seed) {
+    stop();
+
+    m_file.setFileName(rFilePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Impossible de créer l'enregistrement :" << rFilePath;
+        return false;
+    }
+
+    m_buffer.clear();
+    m_buffer.append(FILE_MAGIC, sizeof(FILE_MAGIC));
+    m_buffer.append(static_cast<char>(FILE_VERSION));
+    for (int byteIndex = 0; byteIndex < 8; byteIndex++)
+        m_buffer.append(static_cast<char>((seed >> (8 * byteIndex)) & 0xFF));
+    return true;
+}
+
+//! Termine l'enregistrement en cours et ferme le fichier.
+void InputRecorder::stop() {
+    if (!m_file.isOpen())
+        return;
+
+    flush();
+    m_file.close();
+}
+
+//! \return un booléen qui indique si un enregistrement est en cours.
+bool InputRecorder::isRecording() const {
+    return m_file.isOpen();
+}
+
+//! Enregistre un tick et le temps écoulé qui lui a été transmis.
+void InputRecorder::recordTick(long long elapsedTimeInMilliseconds) {
+    writeRecord(TICK, static_cast<quint64>(qMax(0LL, elapsedTimeInMilliseconds)));
+}
+
+//! Enregistre l'appui sur une touche.
+void InputRecorder::recordKeyPress(int key) {
+    writeRecord(KEY_PRESS, static_cast<quint32>(key));
+}
+
+//! Enregistre le relâchement d'une touche.
+void InputRecorder::recordKeyRelease(int key) {
+    writeRecord(KEY_RELEASE, static_cast<quint32>(key));
+}
+
+//! Ajoute un enregistrement au tampon : l'octet de type suivi de la valeur
+//! encodée en LEB128 (7 bits par octet, le bit de poids fort indiquant la suite).
+void InputRecorder::writeRecord(RecordType type, quint64 value) {
+    if (!m_file.isOpen())
+        return;
+
+    m_buffer.append(static_cast<char>(type));
+    do {
+        quint8 byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        m_buffer.append(static_cast<char>(byte));
+    } while (value != 0);
+
+    if (m_buffer.size() >= FLUSH_THRESHOLD)
+        flush();
+}
+
+//! Écrit le contenu du tampon dans le fichier.
+void InputRecorder::flush() {
+    if (m_buffer.isEmpty())
+        return;
+
+    if (m_file.write(m_buffer) != m_buffer.size())
+        qWarning() << "Erreur d'écriture de l'enregistrement :" << m_file.errorString();
+    m_buffer.clear();
+}
+
+//! Construit un lecteur sans enregistrement.
+InputReplayer::InputReplayer() {
+    m_position = 0;
+    m_seed = 0;
+    m_tickCount = 0;
+}
+
+//! Charge l'enregistrement donné.
+//! \param rFilePath  Chemin du fichier d'enregistrement.
+//! \return un booléen à faux si le fichier ne peut pas être lu ou n'est pas un enregistrement valide.
+bool InputReplayer::open(const QString& rFilePath) {
+    QFile file(rFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Enregistrement introuvable :" << rFilePath;
+        return false;
+    }
+
+    m_data = file.readAll();
+    if (m_data.size() < HEADER_SIZE || !m_data.startsWith(QByteArray(InputRecorder::FILE_MAGIC, sizeof(InputRecorder::FILE_MAGIC)))
+            || static_cast<quint8>(m_data.at(4)) != InputRecorder::FILE_VERSION) {
+        qWarning() << "Le fichier n'est pas un enregistrement valide :" << rFilePath;
+        m_data.clear();
+        return false;
+    }
+
+    m_seed = 0;
+    for (int byteIndex = 0; byteIndex < 8; byteIndex++)
+        m_seed |= static_cast<quint64>(static_cast<quint8>(m_data.at(5 + byteIndex))) << (8 * byteIndex);
+
+    // Compte les ticks, afin de connaître la durée de l'enregistrement.
+    m_position = HEADER_SIZE;
+    m_tickCount = 0;
+    InputRecorder::RecordType type;
+    quint64 value;
+    while (readRecord(type, value)) {
+        if (type == InputRecorder::TICK)
+            m_tickCount++;
+    }
+
+    m_position = HEADER_SIZE;
+    return true;
+}
+
+//! \return la graine de partie mémorisée dans l'en-tête.
+quint64 InputReplayer::seed() const {
+    return m_seed;
+}
+
+//! Lit l'enregistrement suivant.
+//! \param rType   Type de l'enregistrement lu.
+//! \param rValue  Valeur de l'enregistrement lu.
+//! \return un booléen à faux si la fin de l'enregistrement est atteinte (ou s'il est tronqué).
+bool InputReplayer::readRecord(InputRecorder::RecordType& rType, quint64& rValue) {
+    if (atEnd())
+        return false;
+
+    rType = static_cast<InputRecorder::RecordType>(static_cast<quint8>(m_data.at(m_position++)));
+    rValue = 0;
+    int shift = 0;
+    while (m_position < m_data.size() && shift < 64) {
+        const quint8 byte = static_cast<quint8>(m_data.at(m_position++));
+        rValue |= static_cast<quint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            if (rType <= InputRecorder::KEY_RELEASE)
+                return true;
+            break;
+        }
+        shift += 7;
+    }
+
+    // Enregistrement tronqué ou corrompu : la lecture s'arrête là.
+    m_position = static_cast<int>(m_data.size());
+    return false;
+}
+
+//! \return un booléen qui indique si tous les enregistrements ont été lus.
+bool InputReplayer::atEnd() const {
+    return m_position >= m_data.size();
+}
+
+//! \return le nombre de ticks contenus dans l'enregistrement.
+int InputReplayer::tickCount() const {
+    return m_tickCount;
+}
@@ -0,0 +1,88 @@
+/**
+  \file
+  \brief    Déclaration des classes InputRecorder et InputReplayer.
+  \date     octobre 2026
+*/
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+//! \brief Enregistre les entrées d'une partie dans un fichier binaire compact.
+//!
+//! L'enregistrement contient, dans l'ordre où ils ont été transmis à GameCore :
+//!
+//! - chaque appui et relâchement de touche (GameCore::keyPressed() et GameCore::keyReleased()) ;
+//! - chaque tick, avec le temps écoulé transmis à GameCore::tick() et GameScene::tick().
+//!
+//! Les ticks servent de base de temps : un événement clavier est daté par sa position
+//! entre deux ticks, ce qui est exactement ce qui détermine son effet sur la partie.
+//! L'en-tête du fichier contient la graine de partie (GameRandom::seed()).
+//!
+//! Rejoué par InputReplayer avec la même graine, l'enregistrement reproduit la partie
+//! à l'identique, indépendamment de la vitesse de la machine.
+//!
+//! Format (entiers en little endian) :
+//!
+//!     "ZFIR" | version (1 octet) | graine (8 octets) | enregistrements...
+//!
+//! Chaque enregistrement commence par un octet de type (TICK, KEY_PRESS ou KEY_RELEASE),
+//! suivi d'un entier non signé de taille variable (LEB128) : le temps écoulé pour un tick,
+//! le code de la touche pour un événement clavier. Un tick ordinaire occupe ainsi 2 octets.
+class InputRecorder
+{
+public:
+    enum RecordType : quint8 {
+        TICK = 0,
+        KEY_PRESS = 1,
+        KEY_RELEASE = 2
+    };
+
+    static const char FILE_MAGIC[4];
+    static const quint8 FILE_VERSION = 1;
+
+    InputRecorder();
+    ~InputRecorder();
+
+    bool start(const QString& rFilePath, quint64 seed);
+    void stop();
+    bool isRecording() const;
+
+    void recordTick(long long elapsedTimeInMilliseconds);
+    void recordKeyPress(int key);
+    void recordKeyRelease(int key);
+
+private:
+    void writeRecord(RecordType type, quint64 value);
+    void flush();
+
+    QFile m_file;
+    QByteArray m_buffer;
+};
+
+//! \brief Relit un enregistrement produit par InputRecorder.
+//!
+//! open() charge tout le fichier en mémoire et vérifie son en-tête. Les
+//! enregistrements sont ensuite relus dans l'ordre avec readRecord().
+class InputReplayer
+{
+public:
+    InputReplayer();
+
+    bool open(const QString& rFilePath);
+    quint64 seed() const;
+
+    bool readRecord(InputRecorder::RecordType& rType, quint64& rValue);
+    bool atEnd() const;
+    int tickCount() const;
+
+private:
+    QByteArray m_data;
+    int m_position;
+    quint64 m_seed;
+    int m_tickCount;
+};
+
+#endif // INPUTRECORDING_H
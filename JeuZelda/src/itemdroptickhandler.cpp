@@ -0,0 +1,35 @@
+/**
+  \file
+  \brief    Définition de la classe ItemDropTickHandler.
+  \date     octobre 2026
+*/
+#include "itemdroptickhandler.h"
+
+#include "gamepools.h"
+#include "sprite.h"
+
+//! Construit un gestionnaire pour l'objet donné.
+//! \param pParentSprite  Objet laissé par un ennemi.
+ItemDropTickHandler::ItemDropTickHandler(Sprite* pParentSprite) : SpriteTickHandler(pParentSprite) {
+    reset();
+}
+
+//! Remet à zéro la durée de vie de l'objet.
+void ItemDropTickHandler::reset() {
+    m_elapsedTime = 0;
+    m_isBlinkingFast = false;
+}
+
+//! Cadence : fait clignoter l'objet plus vite, puis le rend à son réservoir, selon le temps écoulé.
+//! \param elapsedTimeInMilliseconds  Temps écoulé depuis le tick précédent.
+void ItemDropTickHandler::tick(long long elapsedTimeInMilliseconds) {
+    m_elapsedTime += elapsedTimeInMilliseconds;
+
+    if (!m_isBlinkingFast && m_elapsedTime >= BLINK_DELAY) {
+        m_isBlinkingFast = true;
+        m_pParentSprite->setAnimationSpeed(BLINK_FRAME_DURATION);
+    }
+
+    if (m_elapsedTime >= LIFETIME)
+        GamePools::releaseItemDrop(m_pParentSprite);
+}
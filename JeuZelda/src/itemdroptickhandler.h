@@ -0,0 +1,35 @@
+/**
+  \file
+  \brief    Déclaration de la classe ItemDropTickHandler.
+  \date     octobre 2026
+*/
+#ifndef ITEMDROPTICKHANDLER_H
+#define ITEMDROPTICKHANDLER_H
+
+#include "spritetickhandler.h"
+
+//! \brief Gestionnaire de cadence qui limite la durée de vie d'un objet laissé par un ennemi.
+//!
+//! Après BLINK_DELAY millisecondes de jeu, l'objet clignote plus vite pour avertir le
+//! joueur de sa disparition prochaine. Après LIFETIME millisecondes, il est rendu à son
+//! réservoir (GamePools::releaseItemDrop()).
+//!
+//! Le temps est celui de la cadence du jeu : il ne s'écoule pas lorsque le jeu est en pause.
+class ItemDropTickHandler : public SpriteTickHandler
+{
+public:
+    static const int BLINK_DELAY = 3000;
+    static const int LIFETIME = 6000;
+    static const int BLINK_FRAME_DURATION = 50;
+
+    ItemDropTickHandler(Sprite* pParentSprite = nullptr);
+
+    void reset();
+    void tick(long long elapsedTimeInMilliseconds) override;
+
+private:
+    long long m_elapsedTime;
+    bool m_isBlinkingFast;
+};
+
+#endif // ITEMDROPTICKHANDLER_H
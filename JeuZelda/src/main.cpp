@@ -176,10 +176,61 @@
  *
  */
 
+#include "assetcache.h"
+#include "assetpack.h"
+#include "assetpreloader.h"
+#include "assetregistry.h"
+#include "bulletbenchmark.h"
+#include "collisionbenchmark.h"
+#include "enemybenchmark.h"
+#include "projectilebenchmark.h"
+#include "gamecanvas.h"
+#include "gameclips.h"
+#include "gamerandom.h"
+#include "headlessrunner.h"
 #include "mainfrm.h"
 #include "resources.h"
+#include "scaledframecache.h"
+#include "startupbenchmark.h"
+#include "startuptimer.h"
+#include "textureatlas.h"
+#include "tracerecorder.h"
+#include "workerpool.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QRandomGenerator>
+#include <cstring>
+
+//! \return un booléen qui indique si l'argument donné figure sur la ligne de commande.
+//! Utilisé avant la création de QApplication, qui n'a pas encore analysé les arguments.
+static bool hasArgument(int argc, char *argv[], const char* pArgument) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], pArgument) == 0)
+            return true;
+    }
+    return false;
+}
+
+//! \brief Libère, à la sortie de main(), les ressources partagées du jeu.
+//!
+//! Les images des caches et de l'atlas (des QPixmap statiques) doivent être libérées
+//! avant la destruction de QApplication, et les threads de calcul et de préchargement
+//! arrêtés : déclaré juste après QApplication, cet objet est détruit avant elle, quel
+//! que soit le chemin par lequel main() se termine.
+struct ResourceReleaser {
+    ~ResourceReleaser() {
+        TraceRecorder::stop();
+        WorkerPool::clear();
+        AssetPreloader::clear();
+        AssetPack::close();
+        GameClips::clear();
+        AssetRegistry::clear();
+        ScaledFrameCache::clear();
+        TextureAtlas::clear();
+        AssetCache::clear();
+    }
+};
 
 /**
  * @brief main
@@ -189,12 +240,84 @@
  */
 int main(int argc, char *argv[])
 {
+    // Le temps jusqu'à la première image est mesuré depuis ce point (voir StartupTimer).
+    StartupTimer::start();
+
+    // Sans affichage, la plateforme "offscreen" permet de fonctionner sur une machine
+    // sans écran, à moins qu'une autre plateforme n'ait été explicitement choisie.
+    if ((hasArgument(argc, argv, "--headless") || hasArgument(argc, argv, "--bench-collisions")
+         || hasArgument(argc, argv, "--bench-enemies") || hasArgument(argc, argv, "--bench-projectiles")
+         || hasArgument(argc, argv, "--build-asset-pack") || hasArgument(argc, argv, "--bench-startup")
+         || hasArgument(argc, argv, "--bench-bullets"))
+            && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
     QApplication a(argc, argv);
+    ResourceReleaser resourceReleaser;
+    StartupTimer::mark(StartupTimer::APPLICATION_CREATED);
     QCoreApplication::setOrganizationName("cejef-divtec");
     QCoreApplication::setOrganizationDomain("divtec.ch");
     QCoreApplication::setApplicationName("2023-JCO-ZeldaFighter-FRESALE");
     QGuiApplication::setApplicationDisplayName("2023-JCO-ZeldaFighter-FRESALE");
-    QGuiApplication::setWindowIcon(QIcon(GameFramework::imagesPath() + "JeuZelda/Triforce1.gif"));
+    QGuiApplication::setWindowIcon(QIcon(AssetRegistry::path(AssetRegistry::TRIFORCE_1)));
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption benchCollisionsOption("bench-collisions", "Compare la grille spatiale à l'index BSP de Qt.");
+    QCommandLineOption benchEnemiesOption("bench-enemies", "Mesure la simulation de vagues de milliers d'ennemis.");
+    QCommandLineOption benchProjectilesOption("bench-projectiles", "Compare les traitements par lot des projectiles (scalaire, SSE2, AVX2).");
+    QCommandLineOption headlessOption("headless", "Fait tourner le jeu sans affichage, aussi vite que possible.");
+    QCommandLineOption ticksOption("ticks", "Nombre de ticks à simuler sans affichage.", "nombre",
+                                   QString::number(HeadlessRunner::DEFAULT_TICK_COUNT));
+    QCommandLineOption tickDurationOption("tick-ms", "Temps écoulé (ms) transmis à chaque tick simulé.", "ms",
+                                          QString::number(HeadlessRunner::DEFAULT_TICK_DURATION));
+    QCommandLineOption scriptOption("script", "Script des touches à simuler sans affichage.", "fichier");
+    QCommandLineOption seedOption("seed", "Graine de partie (aléatoire par défaut).", "graine");
+    QCommandLineOption recordOption("record", "Enregistre les entrées de la partie dans le fichier donné.", "fichier");
+    QCommandLineOption replayOption("replay", "Rejoue l'enregistrement donné (sa graine remplace --seed).", "fichier");
+    QCommandLineOption profileOption("profile", "Mesure la durée de chaque phase du tick sans affichage.");
+    QCommandLineOption traceOption("trace", "Enregistre la chronologie des ticks dans le fichier de trace JSON donné.", "fichier");
+    QCommandLineOption buildAssetPackOption("build-asset-pack", "Construit le paquet des images décodées dans le fichier donné.", "fichier");
+    QCommandLineOption noAssetPackOption("no-asset-pack", "Charge les images depuis leurs fichiers, sans le paquet d'images.");
+    QCommandLineOption startupReportOption("startup-report", "Écrit les temps de démarrage dès la première image, puis quitte.");
+    QCommandLineOption aiThreadsOption("ai-threads", "Nombre de threads qui font réfléchir les ennemis (par défaut, un par cœur).", "threads");
+    QCommandLineOption benchStartupOption("bench-startup", "Lance le jeu plusieurs fois et mesure son démarrage.", "lancements",
+                                          QString::number(StartupBenchmark::DEFAULT_LAUNCH_COUNT));
+    QCommandLineOption benchBulletsOption("bench-bullets", "Mesure le tick complet du moteur de projectiles (déplacement, collisions, dessin).", "projectiles",
+                                          QString::number(BulletBenchmark::DEFAULT_BULLET_COUNT));
+    parser.addOptions({ benchCollisionsOption, benchEnemiesOption, benchProjectilesOption, headlessOption, ticksOption, tickDurationOption, scriptOption,
+                        seedOption, recordOption, replayOption, profileOption, traceOption,
+                        buildAssetPackOption, noAssetPackOption, startupReportOption, aiThreadsOption, benchStartupOption, benchBulletsOption });
+    parser.process(a);
+
+    // Threads de la phase de décision des ennemis (voir EnemyStore::update()).
+    if (parser.isSet(aiThreadsOption))
+        WorkerPool::setThreadCount(parser.value(aiThreadsOption).toInt());
+
+    // Banc d'essai de la détection de collisions (grille spatiale vs index BSP de Qt).
+    if (parser.isSet(benchCollisionsOption)) {
+        CollisionBenchmark::run();
+        return 0;
+    }
+
+    // Banc d'essai de la simulation des ennemis (EnemyStore).
+    if (parser.isSet(benchEnemiesOption)) {
+        EnemyBenchmark::run();
+        return 0;
+    }
+
+    // Banc d'essai des traitements par lot des projectiles (ProjectileBuffer).
+    if (parser.isSet(benchProjectilesOption)) {
+        ProjectileBenchmark::run();
+        return 0;
+    }
+
+    // Banc d'essai du démarrage : le jeu est relancé plusieurs fois, sans affichage.
+    if (parser.isSet(benchStartupOption)) {
+        const QStringList extraArguments = parser.isSet(noAssetPackOption) ? QStringList({ "--no-asset-pack" }) : QStringList();
+        return StartupBenchmark::run(parser.value(benchStartupOption).toInt(), extraArguments);
+    }
+    StartupTimer::setReportOnFirstFrame(parser.isSet(startupReportOption));
 
     qDebug() << "App dir path : " << qApp->applicationDirPath();
     qDebug() << "App library paths : " << qApp->libraryPaths();
@@ -204,8 +327,68 @@ int main(int argc, char *argv[])
         qCritical() << "Dossier des ressources introuvable : Fin d'exécution du programme.";
             return -1;
     }
+    StartupTimer::mark(StartupTimer::RESOURCES_FOUND);
+
+    // Construction du paquet des images décodées (voir AssetPack).
+    if (parser.isSet(buildAssetPackOption))
+        return AssetPack::build(parser.value(buildAssetPackOption)) ? 0 : 1;
+
+    // Le paquet d'images, s'il existe, évite de décoder les images au démarrage.
+    // Sans lui, les images sont chargées depuis leurs fichiers.
+    if (!parser.isSet(noAssetPackOption))
+        AssetPack::open(AssetPack::defaultPath());
+
+    // Banc d'essai du moteur de projectiles (BulletEngine), qui a besoin des images du jeu.
+    if (parser.isSet(benchBulletsOption))
+        return BulletBenchmark::run(parser.value(benchBulletsOption).toInt());
+
+    // Graine de partie : avec la même graine et les mêmes entrées, la partie se déroule à l'identique.
+    bool isSeedValid = parser.isSet(seedOption);
+    quint64 seed = isSeedValid ? parser.value(seedOption).toULongLong(&isSeedValid) : 0;
+    if (!isSeedValid) {
+        if (parser.isSet(seedOption))
+            qWarning() << "Graine invalide :" << parser.value(seedOption);
+        seed = QRandomGenerator::global()->generate64();
+    }
+    GameRandom::setSeed(seed);
+    qInfo() << "Graine de partie :" << seed;
+
+    if (parser.isSet(traceOption) && !TraceRecorder::start(parser.value(traceOption)))
+        return 1;
+
+    // Simulation sans affichage.
+    if (parser.isSet(headlessOption)) {
+        HeadlessRunner runner;
+        runner.setTickCount(parser.value(ticksOption).toInt());
+        runner.setTickDuration(parser.value(tickDurationOption).toInt());
+        runner.setRecordPath(parser.value(recordOption));
+        runner.setReplayPath(parser.value(replayOption));
+        runner.setProfilingEnabled(parser.isSet(profileOption));
+        if (parser.isSet(scriptOption) && !runner.loadScript(parser.value(scriptOption)))
+            return 1;
+
+        // Les images du jeu sont décodées en parallèle et rangées dans l'atlas de textures
+        // (voir AssetPreloader) avant le début de la simulation.
+        AssetPreloader::preloadAll();
+        for (int set = 0; set < AssetPreloader::ASSET_SET_COUNT; set++)
+            AssetPreloader::waitFor(static_cast<AssetPreloader::AssetSet>(set));
+        return runner.run();
+    }
 
     MainFrm w;
+    StartupTimer::mark(StartupTimer::MAIN_WINDOW_CREATED);
+    if (parser.isSet(replayOption)) {
+        if (!w.gameCanvas()->startReplay(parser.value(replayOption)))
+            return 1;
+        QObject::connect(w.gameCanvas(), &GameCanvas::replayFinished, &w, &QWidget::close);
+    }
+    if (parser.isSet(recordOption) && !w.gameCanvas()->startRecording(parser.value(recordOption)))
+        return 1;
+
+    // Les images du jeu sont décodées en arrière-plan et rangées dans l'atlas de textures
+    // (voir AssetPreloader). GameCore attend celles dont il a besoin avant de créer ses sprites.
+    AssetPreloader::preloadAll();
+    StartupTimer::mark(StartupTimer::ASSETS_REQUESTED);
     w.showFullScreen();
 
     // Pour un mode d'affichage fenêtré, plein écran
@@ -214,6 +397,8 @@ int main(int argc, char *argv[])
     // Pour un mode d'affichage non-fenêtré, plein écran
     // w.showFullScreen();
 
+    // La fenêtre est détruite avant resourceReleaser, qui libère ensuite les ressources
+    // partagées, puis QApplication.
     return a.exec();
 }
 
@@ -36,3 +36,8 @@ MainFrm::~MainFrm() {
 
     delete ui;
 }
+
+//! \return le cadre de jeu affiché par cette fenêtre.
+GameCanvas* MainFrm::gameCanvas() const {
+    return m_pGameCanvas;
+}
@@ -33,6 +33,8 @@ public:
     explicit MainFrm(QWidget* pParent = nullptr);
     ~MainFrm() override;
 
+    GameCanvas* gameCanvas() const;
+
 private:
     Ui::MainFrm *ui;
 
@@ -0,0 +1,139 @@
+/**
+  \file
+  \brief    Déclaration des classes ObjectPoolBase et ObjectPool.
+  \date     octobre 2026
+*/
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include <functional>
+
+#include <QString>
+#include <QtAlgorithms>
+#include <QVector>
+
+//! \brief Partie non typée d'un réservoir d'objets (ObjectPool) : son nom et ses compteurs.
+//!
+//! Elle permet de parcourir et d'afficher les statistiques de réservoirs de types différents
+//! (voir GamePools::report()).
+class ObjectPoolBase
+{
+public:
+    explicit ObjectPoolBase(const QString& rName) : m_name(rName) {}
+    virtual ~ObjectPoolBase() {}
+
+    QString name() const { return m_name; }
+
+    //! \return le nombre d'objets actuellement utilisés (obtenus et pas encore rendus).
+    int activeCount() const { return m_activeCount; }
+    //! \return le nombre d'objets disponibles dans le réservoir.
+    virtual int idleCount() const = 0;
+    //! \return le plus grand nombre d'objets utilisés simultanément.
+    int highWaterMark() const { return m_highWaterMark; }
+    //! \return le nombre d'objets construits par le réservoir depuis sa création.
+    int allocationCount() const { return m_allocationCount; }
+
+    virtual void clear() = 0;
+
+protected:
+    QString m_name;
+    int m_activeCount = 0;
+    int m_highWaterMark = 0;
+    int m_allocationCount = 0;
+};
+
+//! \brief Réservoir d'objets du type T, recyclés plutôt que détruits.
+//!
+//! acquire() fournit un objet disponible, ou en construit un nouveau avec la fonction de
+//! fabrication donnée au constructeur si le réservoir est vide. release() rend l'objet au
+//! réservoir, qui le conserve pour un prochain acquire().
+//!
+//! Deux fonctions de réinitialisation optionnelles sont appelées :
+//!
+//! - lors de chaque acquire(), pour remettre l'objet dans son état initial ;
+//! - lors de chaque release(), pour le retirer du jeu (par exemple de sa scène).
+//!
+//! Une fois que le réservoir a atteint le nombre d'objets utilisés simultanément par le jeu
+//! (highWaterMark()), obtenir et rendre des objets ne fait plus aucune allocation.
+//!
+//! Le réservoir est propriétaire des objets disponibles, qu'il détruit avec clear() ou
+//! lors de sa destruction. Les objets utilisés appartiennent à leur utilisateur (par exemple
+//! la scène dans laquelle ils ont été placés) : ils doivent être rendus ou détruits par lui.
+template <typename T>
+class ObjectPool : public ObjectPoolBase
+{
+public:
+    typedef std::function<T*()> Factory;
+    typedef std::function<void(T*)> ResetHook;
+
+    //! Construit un réservoir vide.
+    //! \param rName         Nom du réservoir, utilisé pour les statistiques.
+    //! \param factory       Fonction qui construit un nouvel objet.
+    //! \param acquireHook   Fonction appelée avec l'objet lors de chaque acquire().
+    //! \param releaseHook   Fonction appelée avec l'objet lors de chaque release().
+    ObjectPool(const QString& rName, Factory factory, ResetHook acquireHook = ResetHook(), ResetHook releaseHook = ResetHook())
+        : ObjectPoolBase(rName), m_factory(factory), m_acquireHook(acquireHook), m_releaseHook(releaseHook) {}
+
+    ~ObjectPool() override { clear(); }
+
+    //! \return un objet disponible, réinitialisé, ou un nouvel objet si le réservoir est vide.
+    T* acquire() {
+        T* pObject = nullptr;
+        if (m_idleObjects.isEmpty()) {
+            pObject = m_factory();
+            m_allocationCount++;
+        } else {
+            pObject = m_idleObjects.takeLast();
+        }
+
+        m_activeCount++;
+        if (m_activeCount > m_highWaterMark) {
+            m_highWaterMark = m_activeCount;
+            // Tous les objets utilisés pourront être rendus sans agrandir la liste.
+            m_idleObjects.reserve(m_highWaterMark);
+        }
+
+        if (m_acquireHook)
+            m_acquireHook(pObject);
+        return pObject;
+    }
+
+    //! Rend l'objet donné au réservoir.
+    //! L'objet ne doit plus être utilisé par l'appelant.
+    void release(T* pObject) {
+        Q_ASSERT(pObject != nullptr);
+        Q_ASSERT(!m_idleObjects.contains(pObject));
+
+        if (m_releaseHook)
+            m_releaseHook(pObject);
+        m_activeCount--;
+        m_idleObjects.append(pObject);
+    }
+
+    //! Construit à l'avance des objets, afin que le réservoir en compte au moins le nombre donné.
+    void reserve(int objectCount) {
+        m_idleObjects.reserve(objectCount);
+        while (m_activeCount + m_idleObjects.count() < objectCount) {
+            m_idleObjects.append(m_factory());
+            m_allocationCount++;
+        }
+    }
+
+    int idleCount() const override { return static_cast<int>(m_idleObjects.count()); }
+
+    //! Détruit tous les objets disponibles.
+    //! Les objets utilisés ne sont plus comptés : ils appartiennent à leur utilisateur.
+    void clear() override {
+        qDeleteAll(m_idleObjects);
+        m_idleObjects.clear();
+        m_activeCount = 0;
+    }
+
+private:
+    Factory m_factory;
+    ResetHook m_acquireHook;
+    ResetHook m_releaseHook;
+    QVector<T*> m_idleObjects;
+};
+
+#endif // OBJECTPOOL_H
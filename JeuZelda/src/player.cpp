@@ -1,5 +1,8 @@
 #include "player.h"
+#include "assetregistry.h"
 #include "gamecanvas.h"
+#include "gameclips.h"
+#include "gamepools.h"
 #include "resources.h"
 #include "utilities.h"
 #include "gamecore.h"
@@ -8,10 +11,49 @@
 #include "sprite.h"
 #include "projectile.h"
 
-Player::Player(): Sprite(GameFramework::imagesPath() + "JeuZelda/DownLink_1.gif")
+Player::Player(): Sprite()
 {
     //setDebugModeEnabled(true);
-    setData(GameCore::SpriteDataKey::SPRITE_TYPE_KEY, GameCore::PLAYER);
+    setSpriteType(GameCore::PLAYER);
+    initWalkingAnimations();
+}
+
+//! Initialise l'animation de marche du joueur.
+//! Chaque direction possède sa propre animation (GameClips::LINK_WALK_DOWN et
+//! suivantes, dans l'ordre des valeurs de Direction), partagée et construite une
+//! seule fois. Se déplacer ne fait ensuite que changer l'animation affichée.
+void Player::initWalkingAnimations() {
+    // Au départ, le joueur regarde vers le bas.
+    m_walkingDirection = DOWN;
+    setAnimationClip(walkingClip(m_walkingDirection));
+    setAnimationSpeed(WALK_FRAME_DURATION);
+}
+
+//! \return l'animation de marche dans la direction donnée.
+AnimationClipPointer Player::walkingClip(Direction direction) {
+    return GameClips::clip(static_cast<GameClips::ClipId>(GameClips::LINK_WALK_DOWN + direction));
+}
+
+//! Fait marcher le joueur dans la direction donnée.
+//! L'animation de marche correspondante devient active et est démarrée si
+//! nécessaire. Le déplacement lui-même est géré par GameCore.
+//! \param direction  Direction de la marche.
+void Player::walk(Direction direction) {
+    if (direction != m_walkingDirection) {
+        m_walkingDirection = direction;
+        setAnimationClip(walkingClip(direction));
+    }
+    if (!isAnimationRunning())
+        startAnimation();
+}
+
+//! Arrête l'animation de marche du joueur.
+//! Le joueur reste orienté dans la dernière direction de marche.
+void Player::stopWalking() {
+    if (isAnimationRunning()) {
+        stopAnimation();
+        setCurrentAnimationFrame(0);
+    }
 }
 
 //! Création des sprites de la vie du joueur (coeur).
@@ -58,17 +100,17 @@ void Player::damage() {
 //! Fonction qui permet d'ajouter un coeur au joueur.
 void Player::addHeart() {
     // Création du sprite du coeur.
-    QPixmap HearthImage = QPixmap(GameFramework::imagesPath() + "JeuZelda/Coeur.png");
-    int hearthWidth = HearthImage.width() + 1;
+    // L'image est obtenue depuis l'atlas de textures, où elle a été préchargée (AssetPreloader).
+    int hearthWidth = AssetRegistry::frame(AssetRegistry::HEART).size().width() + 1;
 
     // Ajout du coeur à la liste des coeurs du joueur.
-    auto heart = new Sprite(HearthImage);
+    auto heart = new Sprite(AssetRegistry::HEART);
     m_pHearts.append(heart);
     // Ajout du coeur à la scène.
     GameScene* parentScene = this->parentScene();
     // Positionnement du coeur.
     heart->setScale(GameCore::DECOR_SCALE_FACTOR);
-    heart->setData(GameCore::SpriteDataKey::SPRITE_TYPE_KEY, GameCore::HEART);
+    heart->setSpriteType(GameCore::HEART);
     int hearthX = m_pHearts.length() * (hearthWidth + ESPACE_ENTRE_COEURS) - 50;
     parentScene->addSpriteToScene(heart, hearthX, 20);
 }
@@ -80,9 +122,9 @@ void Player::attack(QPointF direction) {
     if(m_pSword != nullptr) {
         return;
     }
-    // Création de l'épée.
-    m_pSword = new Projectile(swordSpeed, direction, GameFramework::imagesPath() + "JeuZelda/ZeldaSpriteSword.png", this);
-    m_pSword->setScale(SWORD_SCALE_FACTOR);
+    // Lancement d'une épée, obtenue de son réservoir.
+    m_pSword = GamePools::swords().acquire();
+    m_pSword->launch(swordSpeed, direction, this);
     m_pSword->setPos(scenePos());
     parentScene()->addSpriteToScene(m_pSword);
 }
@@ -90,8 +132,9 @@ void Player::attack(QPointF direction) {
 //! \brief Player::removeSword
 //! Supprime l'épée du joueur.
 void Player::removeSword() {
-    parentScene()->removeSpriteFromScene(m_pSword);
-    delete m_pSword;
+    if (m_pSword == nullptr)
+        return;
+    GamePools::swords().release(m_pSword);
     m_pSword = nullptr;
 }
 
@@ -10,6 +10,15 @@ class Projectile;
 class Player : public Sprite
 {
 public:
+    //! Direction de déplacement du joueur.
+    //! L'ordre correspond à l'index de l'animation de marche associée.
+    enum Direction {
+        DOWN,
+        UP,
+        LEFT,
+        RIGHT
+    };
+
     Player();
     ~Player();
     void initializeHearts();
@@ -18,6 +27,8 @@ public:
     void addHeart();
     void attack(QPointF direction);
     void removeSword();
+    void walk(Direction direction);
+    void stopWalking();
     bool isDead = false;
     float swordSpeed = 550.0;
     Projectile* m_pSword = nullptr;
@@ -28,8 +39,14 @@ public:
     static constexpr float SWORD_SCALE_FACTOR = 4.0;
 
 private:
+    void initWalkingAnimations();
+    static AnimationClipPointer walkingClip(Direction direction);
+
     static constexpr int ESPACE_ENTRE_COEURS = 60;
     static constexpr int NOMBRES_COEURS = 3;
+    static constexpr int WALK_FRAME_DURATION = 100;
+
+    Direction m_walkingDirection = DOWN;
 
 
 };
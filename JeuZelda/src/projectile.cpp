@@ -10,16 +10,24 @@
 #include "ennemioctopus.h"
 #include <math.h>
 
-Projectile::Projectile(qreal speed, QPointF direction, const QString &rImagePath, Sprite* pOwner, QGraphicsItem* pParent) : Sprite(rImagePath, pParent)
+Projectile::Projectile(qreal speed, QPointF direction, AssetRegistry::AssetId assetId, Sprite* pOwner, QGraphicsItem* pParent) : Sprite(assetId, pParent)
 {
-    m_speed = speed;
-    m_direction = direction;
-    m_pOwner = pOwner;
     // Permet d'identifier le projectile comme étant une épée (SWORD).
-    setData(GameCore::SPRITE_TYPE_KEY, GameCore::PROJECTIL);
+    setSpriteType(GameCore::PROJECTIL);
     // setDebugModeEnabled(true);
     // Permet de centrer l'image du projectile.
     setOffset(sceneBoundingRect().width() / -2.0, sceneBoundingRect().height() / -2.0);
+    launch(speed, direction, pOwner);
+}
+
+//! Prépare le projectile à être lancé, par exemple lorsqu'il est obtenu de son réservoir (GamePools).
+//! \param speed      Vitesse du projectile, en pixels par seconde.
+//! \param direction  Direction du projectile.
+//! \param pOwner     Sprite qui lance le projectile.
+void Projectile::launch(qreal speed, QPointF direction, Sprite* pOwner) {
+    m_speed = speed;
+    m_direction = direction;
+    m_pOwner = pOwner;
     // Permet de faire tourner l'image du projectile dans la bonne direction.
     setRotation(atan2(m_direction.y(), m_direction.x()) * 180 / M_PI);
 }
@@ -27,10 +35,12 @@ Projectile::Projectile(qreal speed, QPointF direction, const QString &rImagePath
 void Projectile::tick(long long elapsedTimeMs) {
     // Déplace le projectile dans la direction spécifiée.
     setPos(pos() + m_direction * m_speed * elapsedTimeMs / 1000.0);
-    if(bottom() < 0 ||
-        top() > parentScene()->height() ||
-        right() < 0 ||
-        left() > parentScene()->width()) {
+    // Le rectangle englobant n'est calculé qu'une fois pour les quatre bords.
+    const QRectF boundingRect = globalBoundingRect();
+    if(boundingRect.bottom() < 0 ||
+        boundingRect.top() > parentScene()->height() ||
+        boundingRect.right() < 0 ||
+        boundingRect.left() > parentScene()->width()) {
         // Le projectile est sorti de la scène, on le supprime.
         if(Player* player = dynamic_cast<Player*>(m_pOwner)) {
             player->removeSword();
@@ -38,26 +48,27 @@ void Projectile::tick(long long elapsedTimeMs) {
         if(EnnemiOctopus* pEnnemy = dynamic_cast<EnnemiOctopus*>(m_pOwner)) {
             pEnnemy->removeProjectile();
         }
+        return;
     }
 
     QList<Sprite*> collisions = parentScene()->collidingSprites(this);
     if(!collisions.isEmpty()) {
         Sprite* pCollisionned = collisions.at(0);
-        if(pCollisionned->data(GameCore::SPRITE_TYPE_KEY) == GameCore::ENNEMI && m_pOwner->data(GameCore::SPRITE_TYPE_KEY) == GameCore::PLAYER) {
+        if(pCollisionned->spriteType() == GameCore::ENNEMI && m_pOwner->spriteType() == GameCore::PLAYER) {
             // Le projectile a touché un ennemi, on utilise la fonction damage de l'ennemi
             Ennemy* pEnnemy = dynamic_cast<Ennemy*>(pCollisionned);
             pEnnemy->damage();
             if(Player* player = dynamic_cast<Player*>(m_pOwner)) {
                 player->removeSword();
             }
-        } else if(pCollisionned->data(GameCore::SPRITE_TYPE_KEY) == GameCore::DECOR) {
+        } else if(pCollisionned->spriteType() == GameCore::DECOR) {
             // Le projectile a touché un décor, on supprime le projectile.
             if(Player* player = dynamic_cast<Player*>(m_pOwner)) {
                 player->removeSword();
             } else if(EnnemiOctopus* pEnnemy = dynamic_cast<EnnemiOctopus*>(m_pOwner)) {
                 pEnnemy->removeProjectile();
             }
-        } else if(pCollisionned->data(GameCore::SPRITE_TYPE_KEY) == GameCore::PLAYER && m_pOwner->data(GameCore::SPRITE_TYPE_KEY) == GameCore::ENNEMI) {
+        } else if(pCollisionned->spriteType() == GameCore::PLAYER && m_pOwner->spriteType() == GameCore::ENNEMI) {
             // Le projectile a touché le joueur, on utilise la fonction damage du joueur.
             Player* pPlayer = dynamic_cast<Player*>(pCollisionned);
             pPlayer->damage();
@@ -65,7 +76,7 @@ void Projectile::tick(long long elapsedTimeMs) {
                 pEnnemy->removeProjectile();
             }
             // si un projectil du joueur touche le projectil d'un ennemi, on supprime le projectil de l'ennemi et le projectil du joueur
-        } else if(pCollisionned->data(GameCore::SPRITE_TYPE_KEY) == GameCore::PROJECTIL) {
+        } else if(pCollisionned->spriteType() == GameCore::PROJECTIL) {
             if(EnnemiOctopus* pEnnemy = dynamic_cast<EnnemiOctopus*>(m_pOwner)) {
                 pEnnemy->removeProjectile();
             }
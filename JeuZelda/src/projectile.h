@@ -6,7 +6,8 @@
 class Projectile : public Sprite
 {
 public:
-    Projectile(qreal speed, QPointF direction, const QString& rImagePath, Sprite* pOwner, QGraphicsItem* pParent = nullptr);
+    Projectile(qreal speed, QPointF direction, AssetRegistry::AssetId assetId, Sprite* pOwner, QGraphicsItem* pParent = nullptr);
+    void launch(qreal speed, QPointF direction, Sprite* pOwner);
     void tick(long long elapsedTimeMs);
     void CreateCloudOndeath(QPointF pos);
     int m_nbreEnnemiDeath = 0;
@@ -0,0 +1,90 @@
+/**
+  \file
+  \brief    Définition de la classe ProjectileBenchmark.
+  \date     octobre 2026
+*/
+#include "projectilebenchmark.h"
+
+#include <cstring>
+#include <QElapsedTimer>
+#include <QtDebug>
+
+#include "randomstream.h"
+
+const int TICK_COUNT = 500;
+const int TICK_DURATION = 16;
+const double WORLD_WIDTH = 1280.0;
+const double WORLD_HEIGHT = 720.0;
+const double PROJECTILE_SIZE = 24.0;
+const double MAX_SPEED = 400.0;
+const quint64 RANDOM_SEED = 2026;
+
+//! Lance le banc d'essai pour chacun des nombres de projectiles donnés et écrit les
+//! résultats dans la sortie de log.
+//! \param rProjectileCounts  Nombres de projectiles à déplacer.
+void ProjectileBenchmark::run(const QList<int>& rProjectileCounts) {
+    qInfo().noquote() << QString("Déplacement des projectiles : %1 ticks de %2 ms par mesure, traitement par défaut : %3")
+                         .arg(TICK_COUNT).arg(TICK_DURATION)
+                         .arg(ProjectileBuffer::kernelSetName(ProjectileBuffer::bestKernelSet()));
+    qInfo().noquote() << QString("%1 | %2 | %3 | %4").arg(QStringLiteral("Projectiles"), 11)
+                                                      .arg(QStringLiteral("Traitement"), 10)
+                                                      .arg(QStringLiteral("Tick (µs)"), 10)
+                                                      .arg(QStringLiteral("Accélération"), 12);
+
+    for (int projectileCount : rProjectileCounts) {
+        ProjectileBuffer scalarBuffer;
+        const double scalarMicroseconds = measure(projectileCount, ProjectileBuffer::SCALAR_KERNELS, scalarBuffer);
+
+        for (int set = 0; set < ProjectileBuffer::KERNEL_SET_COUNT; ++set) {
+            const ProjectileBuffer::KernelSet kernelSet = static_cast<ProjectileBuffer::KernelSet>(set);
+            if (!ProjectileBuffer::isSupported(kernelSet))
+                continue;
+
+            double microseconds = scalarMicroseconds;
+            if (kernelSet != ProjectileBuffer::SCALAR_KERNELS) {
+                ProjectileBuffer buffer;
+                microseconds = measure(projectileCount, kernelSet, buffer);
+
+                // Chaque jeu d'instructions doit donner exactement le résultat scalaire.
+                bool isIdentical = true;
+                for (int slot = 0; slot < projectileCount && isIdentical; ++slot) {
+                    isIdentical = buffer.position(slot) == scalarBuffer.position(slot)
+                            && buffer.isOutOfBounds(slot) == scalarBuffer.isOutOfBounds(slot);
+                }
+                if (!isIdentical)
+                    qWarning() << "Résultat différent de la version scalaire :" << ProjectileBuffer::kernelSetName(kernelSet);
+            }
+
+            qInfo().noquote() << QString("%1 | %2 | %3 | %4")
+                                 .arg(projectileCount, 11)
+                                 .arg(QString(ProjectileBuffer::kernelSetName(kernelSet)), 10)
+                                 .arg(microseconds, 10, 'f', 2)
+                                 .arg(scalarMicroseconds / microseconds, 11, 'f', 2) + "x";
+        }
+    }
+}
+
+//! Mesure le temps moyen d'un tick (déplacement et masque des projectiles sortis).
+//! \param projectileCount  Nombre de projectiles.
+//! \param kernelSet        Jeu d'instructions utilisé.
+//! \param rBuffer          Tampon à remplir, qui contient ensuite le résultat du dernier tick.
+//! \return la durée moyenne d'un tick, en microsecondes.
+double ProjectileBenchmark::measure(int projectileCount, ProjectileBuffer::KernelSet kernelSet, ProjectileBuffer& rBuffer) {
+    RandomStream random(RANDOM_SEED);
+    const QSizeF projectileSize(PROJECTILE_SIZE, PROJECTILE_SIZE);
+    const QRectF bounds(0.0, 0.0, WORLD_WIDTH, WORLD_HEIGHT);
+
+    rBuffer.setKernelSet(kernelSet);
+    rBuffer.reserve(projectileCount);
+    for (int i = 0; i < projectileCount; ++i) {
+        const QPointF position(random.bounded(WORLD_WIDTH), random.bounded(WORLD_HEIGHT));
+        const QPointF velocity(random.bounded(2.0 * MAX_SPEED) - MAX_SPEED, random.bounded(2.0 * MAX_SPEED) - MAX_SPEED);
+        rBuffer.add(position, velocity, projectileSize);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int tick = 0; tick < TICK_COUNT; ++tick)
+        rBuffer.step(TICK_DURATION, bounds);
+    return timer.nsecsElapsed() / 1.0e3 / TICK_COUNT;
+}
@@ -0,0 +1,35 @@
+/**
+  \file
+  \brief    Déclaration de la classe ProjectileBenchmark.
+  \date     octobre 2026
+*/
+#ifndef PROJECTILEBENCHMARK_H
+#define PROJECTILEBENCHMARK_H
+
+#include <QList>
+
+#include "projectilebuffer.h"
+
+//! \brief Banc d'essai des traitements par lot de ProjectileBuffer.
+//!
+//! Pour chaque nombre de projectiles demandé, les mêmes projectiles (positions et
+//! vitesses pseudo-aléatoires, mais reproductibles) sont déplacés pendant quelques
+//! centaines de ticks avec chaque jeu d'instructions que le processeur permet
+//! (version scalaire, SSE2, AVX2). Le temps moyen d'un tick et l'accélération par
+//! rapport à la version scalaire sont écrits dans la sortie de log ; un avertissement
+//! est écrit si un jeu d'instructions ne donne pas exactement le même résultat que la
+//! version scalaire.
+//!
+//! Le banc d'essai est lancé par l'option `--bench-projectiles` de la ligne de commande.
+class ProjectileBenchmark
+{
+public:
+    static void run(const QList<int>& rProjectileCounts = QList<int>({ 1000, 10000, 100000 }));
+
+private:
+    ProjectileBenchmark() = delete;
+
+    static double measure(int projectileCount, ProjectileBuffer::KernelSet kernelSet, ProjectileBuffer& rBuffer);
+};
+
+#endif // PROJECTILEBENCHMARK_H
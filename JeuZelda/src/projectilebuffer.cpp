@@ -0,0 +1,369 @@
+/**
+  \file
+  \brief    Définition de la classe ProjectileBuffer.
+  \date     octobre 2026
+*/
+#include "projectilebuffer.h"
+
+#include <array>
+#include <cstring>
+#include <new>
+#include <QtAlgorithms>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PROJECTILE_BUFFER_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// Avec GCC et Clang, les traitements SSE2 et AVX2 sont compilés pour leur jeu
+// d'instructions, quelles que soient les options du projet ; ils ne sont appelés que si
+// le processeur le permet. MSVC accepte ces instructions sans attribut.
+#if defined(__GNUC__) || defined(__clang__)
+#define KERNEL_TARGET(name) __attribute__((target(name)))
+#else
+#define KERNEL_TARGET(name)
+#endif
+
+namespace {
+
+//! Tableaux et paramètres transmis aux traitements par lot.
+struct StepArguments {
+    float* pX;
+    float* pY;
+    const float* pVelocityX;
+    const float* pVelocityY;
+    const float* pHalfWidth;
+    const float* pHalfHeight;
+    int count;
+    float elapsedSeconds;
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+    quint64* pOutOfBoundsMask;
+};
+
+typedef void (*StepKernel)(const StepArguments& rArguments);
+
+//! Version scalaire : déplace les projectiles un à un et note ceux qui sont sortis.
+void stepScalar(const StepArguments& rArguments) {
+    for (int i = 0; i < rArguments.count; ++i) {
+        const float x = rArguments.pX[i] + rArguments.pVelocityX[i] * rArguments.elapsedSeconds;
+        const float y = rArguments.pY[i] + rArguments.pVelocityY[i] * rArguments.elapsedSeconds;
+        rArguments.pX[i] = x;
+        rArguments.pY[i] = y;
+        const bool isOut = x + rArguments.pHalfWidth[i] < rArguments.minX
+                || x - rArguments.pHalfWidth[i] > rArguments.maxX
+                || y + rArguments.pHalfHeight[i] < rArguments.minY
+                || y - rArguments.pHalfHeight[i] > rArguments.maxY;
+        if (isOut)
+            rArguments.pOutOfBoundsMask[i / 64] |= quint64(1) << (i % 64);
+    }
+}
+
+#ifdef PROJECTILE_BUFFER_X86
+
+//! Version SSE2 : 4 projectiles à la fois. Les tableaux étant alignés et leur capacité un
+//! multiple de 8, le dernier paquet peut déborder sur la réserve, dont les bits sont
+//! effacés par l'appelant.
+KERNEL_TARGET("sse2")
+void stepSse2(const StepArguments& rArguments) {
+    const __m128 elapsedSeconds = _mm_set1_ps(rArguments.elapsedSeconds);
+    const __m128 minX = _mm_set1_ps(rArguments.minX);
+    const __m128 minY = _mm_set1_ps(rArguments.minY);
+    const __m128 maxX = _mm_set1_ps(rArguments.maxX);
+    const __m128 maxY = _mm_set1_ps(rArguments.maxY);
+
+    for (int i = 0; i < rArguments.count; i += 4) {
+        const __m128 x = _mm_add_ps(_mm_load_ps(rArguments.pX + i),
+                                    _mm_mul_ps(_mm_load_ps(rArguments.pVelocityX + i), elapsedSeconds));
+        const __m128 y = _mm_add_ps(_mm_load_ps(rArguments.pY + i),
+                                    _mm_mul_ps(_mm_load_ps(rArguments.pVelocityY + i), elapsedSeconds));
+        _mm_store_ps(rArguments.pX + i, x);
+        _mm_store_ps(rArguments.pY + i, y);
+
+        const __m128 halfWidth = _mm_load_ps(rArguments.pHalfWidth + i);
+        const __m128 halfHeight = _mm_load_ps(rArguments.pHalfHeight + i);
+        const __m128 isOutX = _mm_or_ps(_mm_cmplt_ps(_mm_add_ps(x, halfWidth), minX),
+                                        _mm_cmpgt_ps(_mm_sub_ps(x, halfWidth), maxX));
+        const __m128 isOutY = _mm_or_ps(_mm_cmplt_ps(_mm_add_ps(y, halfHeight), minY),
+                                        _mm_cmpgt_ps(_mm_sub_ps(y, halfHeight), maxY));
+        const quint64 bits = static_cast<quint64>(_mm_movemask_ps(_mm_or_ps(isOutX, isOutY)));
+        rArguments.pOutOfBoundsMask[i / 64] |= bits << (i % 64);
+    }
+}
+
+//! Version AVX2 : 8 projectiles à la fois (voir stepSse2()).
+KERNEL_TARGET("avx2")
+void stepAvx2(const StepArguments& rArguments) {
+    const __m256 elapsedSeconds = _mm256_set1_ps(rArguments.elapsedSeconds);
+    const __m256 minX = _mm256_set1_ps(rArguments.minX);
+    const __m256 minY = _mm256_set1_ps(rArguments.minY);
+    const __m256 maxX = _mm256_set1_ps(rArguments.maxX);
+    const __m256 maxY = _mm256_set1_ps(rArguments.maxY);
+
+    for (int i = 0; i < rArguments.count; i += 8) {
+        const __m256 x = _mm256_add_ps(_mm256_load_ps(rArguments.pX + i),
+                                       _mm256_mul_ps(_mm256_load_ps(rArguments.pVelocityX + i), elapsedSeconds));
+        const __m256 y = _mm256_add_ps(_mm256_load_ps(rArguments.pY + i),
+                                       _mm256_mul_ps(_mm256_load_ps(rArguments.pVelocityY + i), elapsedSeconds));
+        _mm256_store_ps(rArguments.pX + i, x);
+        _mm256_store_ps(rArguments.pY + i, y);
+
+        const __m256 halfWidth = _mm256_load_ps(rArguments.pHalfWidth + i);
+        const __m256 halfHeight = _mm256_load_ps(rArguments.pHalfHeight + i);
+        const __m256 isOutX = _mm256_or_ps(_mm256_cmp_ps(_mm256_add_ps(x, halfWidth), minX, _CMP_LT_OQ),
+                                           _mm256_cmp_ps(_mm256_sub_ps(x, halfWidth), maxX, _CMP_GT_OQ));
+        const __m256 isOutY = _mm256_or_ps(_mm256_cmp_ps(_mm256_add_ps(y, halfHeight), minY, _CMP_LT_OQ),
+                                           _mm256_cmp_ps(_mm256_sub_ps(y, halfHeight), maxY, _CMP_GT_OQ));
+        const quint64 bits = static_cast<quint64>(_mm256_movemask_ps(_mm256_or_ps(isOutX, isOutY)));
+        rArguments.pOutOfBoundsMask[i / 64] |= bits << (i % 64);
+    }
+}
+
+#endif // PROJECTILE_BUFFER_X86
+
+//! \return le traitement par lot du jeu d'instructions donné.
+StepKernel stepKernel(ProjectileBuffer::KernelSet kernelSet) {
+    switch (kernelSet) {
+#ifdef PROJECTILE_BUFFER_X86
+    case ProjectileBuffer::SSE2_KERNELS:
+        return stepSse2;
+    case ProjectileBuffer::AVX2_KERNELS:
+        return stepAvx2;
+#endif
+    default:
+        return stepScalar;
+    }
+}
+
+//! \return un booléen qui indique si le processeur (et le système) permet d'utiliser
+//! le jeu d'instructions donné.
+bool detectKernelSet(ProjectileBuffer::KernelSet kernelSet) {
+    if (kernelSet == ProjectileBuffer::SCALAR_KERNELS)
+        return true;
+#if defined(PROJECTILE_BUFFER_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (kernelSet == ProjectileBuffer::SSE2_KERNELS)
+        return __builtin_cpu_supports("sse2");
+    if (kernelSet == ProjectileBuffer::AVX2_KERNELS)
+        return __builtin_cpu_supports("avx2");
+#elif defined(PROJECTILE_BUFFER_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    if (kernelSet == ProjectileBuffer::SSE2_KERNELS)
+        return (info[3] & (1 << 26)) != 0;
+    if (kernelSet == ProjectileBuffer::AVX2_KERNELS) {
+        // Le système doit sauvegarder les registres AVX (OSXSAVE, puis XCR0).
+        const bool hasAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0
+                && (_xgetbv(0) & 6) == 6;
+        if (!hasAvx || maxLeaf < 7)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }
+#endif
+    return false;
+}
+
+//! \return un tableau aligné de count éléments.
+template <typename T>
+T* allocateArray(int count) {
+    return static_cast<T*>(::operator new(sizeof(T) * static_cast<size_t>(count),
+                                          std::align_val_t(ProjectileBuffer::ALIGNMENT)));
+}
+
+//! Libère un tableau obtenu de allocateArray().
+template <typename T>
+void freeArray(T* pArray) {
+    ::operator delete(pArray, std::align_val_t(ProjectileBuffer::ALIGNMENT));
+}
+
+//! Remplace le tableau donné par un tableau de la capacité donnée, qui reprend ses
+//! count premiers éléments et dont le reste est mis à zéro.
+template <typename T>
+void resizeArray(T*& rpArray, int count, int capacity) {
+    T* pNewArray = allocateArray<T>(capacity);
+    if (count > 0)
+        std::memcpy(pNewArray, rpArray, sizeof(T) * static_cast<size_t>(count));
+    std::memset(pNewArray + count, 0, sizeof(T) * static_cast<size_t>(capacity - count));
+    freeArray(rpArray);
+    rpArray = pNewArray;
+}
+
+// Granularité de la capacité : un mot entier du masque, soit 8 paquets AVX2.
+const int CAPACITY_GRANULARITY = 64;
+
+} // namespace
+
+ProjectileBuffer::ProjectileBuffer()
+    : m_kernelSet(bestKernelSet()) {
+}
+
+ProjectileBuffer::~ProjectileBuffer() {
+    freeArray(m_pX);
+    freeArray(m_pY);
+    freeArray(m_pVelocityX);
+    freeArray(m_pVelocityY);
+    freeArray(m_pHalfWidth);
+    freeArray(m_pHalfHeight);
+    freeArray(m_pOutOfBoundsMask);
+}
+
+//! Ajoute un projectile.
+//! \param rPosition  Centre du projectile.
+//! \param rVelocity  Vitesse du projectile, en pixels par seconde.
+//! \param rSize      Taille du projectile, qui détermine quand il est sorti.
+//! \return l'indice du projectile.
+int ProjectileBuffer::add(const QPointF& rPosition, const QPointF& rVelocity, const QSizeF& rSize) {
+    if (m_count == m_capacity)
+        grow(qMax(CAPACITY_GRANULARITY, m_capacity * 2));
+    const int slot = m_count++;
+    m_pX[slot] = static_cast<float>(rPosition.x());
+    m_pY[slot] = static_cast<float>(rPosition.y());
+    m_pVelocityX[slot] = static_cast<float>(rVelocity.x());
+    m_pVelocityY[slot] = static_cast<float>(rVelocity.y());
+    m_pHalfWidth[slot] = static_cast<float>(rSize.width() / 2.0);
+    m_pHalfHeight[slot] = static_cast<float>(rSize.height() / 2.0);
+    return slot;
+}
+
+//! Retire le projectile donné : le dernier projectile prend sa place.
+//! \param slot  Indice du projectile à retirer.
+//! \return l'ancien indice du projectile déplacé à la place de celui retiré, ou -1 si
+//! le projectile retiré était le dernier.
+int ProjectileBuffer::remove(int slot) {
+    Q_ASSERT(slot >= 0 && slot < m_count);
+    const int lastSlot = --m_count;
+    if (slot != lastSlot) {
+        m_pX[slot] = m_pX[lastSlot];
+        m_pY[slot] = m_pY[lastSlot];
+        m_pVelocityX[slot] = m_pVelocityX[lastSlot];
+        m_pVelocityY[slot] = m_pVelocityY[lastSlot];
+        m_pHalfWidth[slot] = m_pHalfWidth[lastSlot];
+        m_pHalfHeight[slot] = m_pHalfHeight[lastSlot];
+    }
+    // La place libérée reste lue par les traitements par lot : elle ne doit plus bouger.
+    m_pVelocityX[lastSlot] = 0.0f;
+    m_pVelocityY[lastSlot] = 0.0f;
+    return slot != lastSlot ? lastSlot : -1;
+}
+
+//! Retire tous les projectiles, sans libérer la mémoire.
+void ProjectileBuffer::clear() {
+    if (m_capacity > 0) {
+        std::memset(m_pVelocityX, 0, sizeof(float) * static_cast<size_t>(m_capacity));
+        std::memset(m_pVelocityY, 0, sizeof(float) * static_cast<size_t>(m_capacity));
+        std::memset(m_pOutOfBoundsMask, 0, sizeof(quint64) * static_cast<size_t>(m_capacity / 64));
+    }
+    m_count = 0;
+}
+
+//! Prépare la place d'au moins capacity projectiles.
+void ProjectileBuffer::reserve(int capacity) {
+    if (capacity > m_capacity)
+        grow(capacity);
+}
+
+//! Déplace le projectile donné.
+void ProjectileBuffer::setPosition(int slot, const QPointF& rPosition) {
+    m_pX[slot] = static_cast<float>(rPosition.x());
+    m_pY[slot] = static_cast<float>(rPosition.y());
+}
+
+//! Change la vitesse, en pixels par seconde, du projectile donné.
+void ProjectileBuffer::setVelocity(int slot, const QPointF& rVelocity) {
+    m_pVelocityX[slot] = static_cast<float>(rVelocity.x());
+    m_pVelocityY[slot] = static_cast<float>(rVelocity.y());
+}
+
+//! Déplace tous les projectiles selon leur vitesse, puis calcule le masque des
+//! projectiles entièrement sortis du rectangle donné (isOutOfBounds()).
+//! \param elapsedTimeInMilliseconds  Temps de jeu écoulé depuis le déplacement précédent.
+//! \param rBounds                    Rectangle hors duquel un projectile est sorti.
+//! \return le nombre de projectiles sortis.
+int ProjectileBuffer::step(long long elapsedTimeInMilliseconds, const QRectF& rBounds) {
+    if (m_count == 0)
+        return 0;
+
+    const int usedWordCount = (m_count + 63) / 64;
+    std::memset(m_pOutOfBoundsMask, 0, sizeof(quint64) * static_cast<size_t>(usedWordCount));
+
+    const StepArguments arguments = {
+        m_pX, m_pY, m_pVelocityX, m_pVelocityY, m_pHalfWidth, m_pHalfHeight, m_count,
+        static_cast<float>(elapsedTimeInMilliseconds / 1000.0),
+        static_cast<float>(rBounds.left()), static_cast<float>(rBounds.top()),
+        static_cast<float>(rBounds.right()), static_cast<float>(rBounds.bottom()),
+        m_pOutOfBoundsMask
+    };
+    stepKernel(m_kernelSet)(arguments);
+
+    // Efface les bits du dernier paquet qui ne correspondent à aucun projectile.
+    if (m_count % 64 != 0)
+        m_pOutOfBoundsMask[usedWordCount - 1] &= (quint64(1) << (m_count % 64)) - 1;
+
+    int outOfBoundsCount = 0;
+    for (int word = 0; word < usedWordCount; ++word)
+        outOfBoundsCount += static_cast<int>(qPopulationCount(m_pOutOfBoundsMask[word]));
+    return outOfBoundsCount;
+}
+
+//! Impose le jeu d'instructions des traitements par lot. Un jeu que le processeur ne
+//! permet pas est remplacé par le meilleur jeu disponible.
+void ProjectileBuffer::setKernelSet(KernelSet kernelSet) {
+    m_kernelSet = isSupported(kernelSet) ? kernelSet : bestKernelSet();
+}
+
+//! \return le jeu d'instructions le plus rapide que le processeur permet.
+ProjectileBuffer::KernelSet ProjectileBuffer::bestKernelSet() {
+    static const KernelSet s_bestKernelSet = isSupported(AVX2_KERNELS) ? AVX2_KERNELS
+                                           : isSupported(SSE2_KERNELS) ? SSE2_KERNELS
+                                           : SCALAR_KERNELS;
+    return s_bestKernelSet;
+}
+
+//! \return un booléen qui indique si le processeur permet le jeu d'instructions donné.
+//! La détection a lieu une seule fois, à l'initialisation d'une variable statique locale,
+//! que le langage garantit sans concurrence entre threads.
+bool ProjectileBuffer::isSupported(KernelSet kernelSet) {
+    static const std::array<bool, KERNEL_SET_COUNT> s_isSupported = []() {
+        std::array<bool, KERNEL_SET_COUNT> isSupported = {};
+        for (int set = 0; set < KERNEL_SET_COUNT; ++set)
+            isSupported[set] = detectKernelSet(static_cast<KernelSet>(set));
+        return isSupported;
+    }();
+    return kernelSet >= 0 && kernelSet < KERNEL_SET_COUNT && s_isSupported[kernelSet];
+}
+
+//! \return le nom du jeu d'instructions donné.
+const char* ProjectileBuffer::kernelSetName(KernelSet kernelSet) {
+    switch (kernelSet) {
+    case SCALAR_KERNELS:
+        return "scalaire";
+    case SSE2_KERNELS:
+        return "SSE2";
+    case AVX2_KERNELS:
+        return "AVX2";
+    case KERNEL_SET_COUNT:
+        break;
+    }
+    return "";
+}
+
+//! Agrandit les tableaux à la capacité donnée, arrondie au mot de masque supérieur.
+void ProjectileBuffer::grow(int capacity) {
+    capacity = (capacity + CAPACITY_GRANULARITY - 1) / CAPACITY_GRANULARITY * CAPACITY_GRANULARITY;
+    resizeArray(m_pX, m_count, capacity);
+    resizeArray(m_pY, m_count, capacity);
+    resizeArray(m_pVelocityX, m_count, capacity);
+    resizeArray(m_pVelocityY, m_count, capacity);
+    resizeArray(m_pHalfWidth, m_count, capacity);
+    resizeArray(m_pHalfHeight, m_count, capacity);
+    resizeArray(m_pOutOfBoundsMask, m_capacity / 64, capacity / 64);
+    m_capacity = capacity;
+}
@@ -0,0 +1,90 @@
+/**
+  \file
+  \brief    Déclaration de la classe ProjectileBuffer.
+  \date     octobre 2026
+*/
+#ifndef PROJECTILEBUFFER_H
+#define PROJECTILEBUFFER_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QtGlobal>
+
+//! \brief Positions et vitesses d'un grand nombre de projectiles, rangées dans des
+//! tableaux de flottants alignés.
+//!
+//! Chaque champ (position, vitesse, demi-taille) est un tableau contigu aligné sur
+//! 32 octets, dont la capacité est un multiple de 64 (un mot du masque des projectiles
+//! sortis) : les traitements par lot lisent ces tableaux par paquets de 4 (SSE2) ou de
+//! 8 (AVX2) projectiles, sans cas particulier pour la fin du tableau.
+//!
+//! step() déplace tous les projectiles selon leur vitesse puis calcule, pour tout le lot,
+//! le masque des projectiles entièrement sortis d'un rectangle donné (isOutOfBounds()).
+//! Le traitement utilisé est choisi à l'exécution selon le processeur (bestKernelSet()) :
+//! AVX2, SSE2 ou, à défaut, une version scalaire. Toutes donnent le même résultat ;
+//! setKernelSet() permet d'en imposer une (banc d'essai ProjectileBenchmark).
+//!
+//! Un projectile est retiré en O(1) : le dernier projectile prend sa place (remove()).
+class ProjectileBuffer
+{
+public:
+    enum KernelSet {
+        SCALAR_KERNELS,     //!< Version portable, un projectile à la fois.
+        SSE2_KERNELS,       //!< 4 projectiles à la fois (processeurs x86).
+        AVX2_KERNELS,       //!< 8 projectiles à la fois (processeurs x86 récents).
+        KERNEL_SET_COUNT
+    };
+
+    //! Alignement, en octets, des tableaux de flottants.
+    static constexpr int ALIGNMENT = 32;
+    //! Nombre de flottants d'un paquet AVX2 (la capacité, multiple de 64, en est un multiple).
+    static constexpr int LANE_COUNT = 8;
+
+    ProjectileBuffer();
+    ~ProjectileBuffer();
+    ProjectileBuffer(const ProjectileBuffer&) = delete;
+    ProjectileBuffer& operator=(const ProjectileBuffer&) = delete;
+
+    int add(const QPointF& rPosition, const QPointF& rVelocity, const QSizeF& rSize);
+    int remove(int slot);
+    void clear();
+    void reserve(int capacity);
+
+    int count() const { return m_count; }
+
+    QPointF position(int slot) const { return QPointF(m_pX[slot], m_pY[slot]); }
+    void setPosition(int slot, const QPointF& rPosition);
+    QPointF velocity(int slot) const { return QPointF(m_pVelocityX[slot], m_pVelocityY[slot]); }
+    void setVelocity(int slot, const QPointF& rVelocity);
+
+    int step(long long elapsedTimeInMilliseconds, const QRectF& rBounds);
+    bool isOutOfBounds(int slot) const { return (m_pOutOfBoundsMask[slot / 64] >> (slot % 64)) & 1; }
+    const quint64* outOfBoundsMask() const { return m_pOutOfBoundsMask; }
+
+    KernelSet kernelSet() const { return m_kernelSet; }
+    void setKernelSet(KernelSet kernelSet);
+
+    static KernelSet bestKernelSet();
+    static bool isSupported(KernelSet kernelSet);
+    static const char* kernelSetName(KernelSet kernelSet);
+
+private:
+    void grow(int capacity);
+
+    int m_count = 0;
+    int m_capacity = 0;
+    KernelSet m_kernelSet;
+
+    // Centre, vitesse (pixels par seconde) et demi-taille de chaque projectile.
+    float* m_pX = nullptr;
+    float* m_pY = nullptr;
+    float* m_pVelocityX = nullptr;
+    float* m_pVelocityY = nullptr;
+    float* m_pHalfWidth = nullptr;
+    float* m_pHalfHeight = nullptr;
+    // Un bit par projectile, calculé par step().
+    quint64* m_pOutOfBoundsMask = nullptr;
+};
+
+#endif // PROJECTILEBUFFER_H
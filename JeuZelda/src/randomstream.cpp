@@ -0,0 +1,89 @@
+/**
+  \file
+  \brief    Définition de la classe RandomStream.
+  \date     octobre 2026
+*/
+#include "randomstream.h"
+
+//! Fait tourner les bits de la valeur donnée vers la gauche.
+static inline quint32 rotateLeft(quint32 value, int bitCount) {
+    return (value << bitCount) | (value >> (32 - bitCount));
+}
+
+//! Fait avancer l'état donné de l'algorithme splitmix64 et retourne la valeur produite.
+//! Utilisé uniquement pour dériver l'état du générateur à partir de la graine.
+static quint64 splitMix64(quint64& rState) {
+    quint64 value = (rState += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+//! Construit un générateur initialisé avec la graine donnée.
+//! \param seed  Graine du générateur.
+RandomStream::RandomStream(quint64 seed) {
+    this->seed(seed);
+}
+
+//! Réinitialise le générateur avec la graine donnée.
+//! \param seed  Graine du générateur.
+void RandomStream::seed(quint64 seed) {
+    quint64 splitMixState = seed;
+    const quint64 first = splitMix64(splitMixState);
+    const quint64 second = splitMix64(splitMixState);
+    m_state[0] = static_cast<quint32>(first);
+    m_state[1] = static_cast<quint32>(first >> 32);
+    m_state[2] = static_cast<quint32>(second);
+    m_state[3] = static_cast<quint32>(second >> 32);
+}
+
+//! \return un nombre pseudo-aléatoire de 32 bits.
+quint32 RandomStream::generate() {
+    const quint32 result = rotateLeft(m_state[1] * 5, 7) * 9;
+    const quint32 t = m_state[1] << 9;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotateLeft(m_state[3], 11);
+
+    return result;
+}
+
+//! \return un nombre entier pseudo-aléatoire compris entre 0 (inclus) et highest (exclu).
+//! Si highest n'est pas positif, retourne 0.
+int RandomStream::bounded(int highest) {
+    if (highest <= 0)
+        return 0;
+
+    // Méthode de Lemire : multiplication puis rejet des rares valeurs qui
+    // introduiraient un biais.
+    const quint32 range = static_cast<quint32>(highest);
+    quint64 product = static_cast<quint64>(generate()) * range;
+    quint32 low = static_cast<quint32>(product);
+    if (low < range) {
+        const quint32 threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<quint64>(generate()) * range;
+            low = static_cast<quint32>(product);
+        }
+    }
+    return static_cast<int>(product >> 32);
+}
+
+//! \return un nombre entier pseudo-aléatoire compris entre lowest (inclus) et highest (exclu),
+//! comme QRandomGenerator::bounded(int, int).
+int RandomStream::bounded(int lowest, int highest) {
+    return lowest + bounded(highest - lowest);
+}
+
+//! \return un nombre décimal pseudo-aléatoire compris entre 0 (inclus) et highest (exclu),
+//! comme QRandomGenerator::bounded(double).
+double RandomStream::bounded(double highest) {
+    // Deux instructions distinctes, afin que l'ordre des tirages ne dépende pas du compilateur.
+    const quint64 high = generate();
+    const quint64 bits = (high << 32) | generate();
+    return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0) * highest;
+}
@@ -0,0 +1,37 @@
+/**
+  \file
+  \brief    Déclaration de la classe RandomStream.
+  \date     octobre 2026
+*/
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+
+#include <QtGlobal>
+
+//! \brief Générateur de nombres pseudo-aléatoires rapide et reproductible.
+//!
+//! RandomStream implémente l'algorithme xoshiro128** : son état tient en
+//! quatre entiers de 32 bits, et chaque tirage ne coûte que quelques opérations,
+//! sans aucun verrou (contrairement à QRandomGenerator::global()).
+//!
+//! Deux générateurs initialisés avec la même graine (seed()) produisent
+//! exactement la même suite de nombres, quelle que soit la plateforme.
+//!
+//! Un générateur ne doit être utilisé que par un seul thread à la fois.
+class RandomStream
+{
+public:
+    explicit RandomStream(quint64 seed = 0);
+
+    void seed(quint64 seed);
+
+    quint32 generate();
+    int bounded(int highest);
+    int bounded(int lowest, int highest);
+    double bounded(double highest);
+
+private:
+    quint32 m_state[4];
+};
+
+#endif // RANDOMSTREAM_H
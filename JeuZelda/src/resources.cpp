@@ -13,6 +13,7 @@
 
 namespace GameFramework {
     static QString resourcesLocation;
+    static QString imagesLocation;
 /**
 Cette fonction retourne le chemin absolu du répertoire res.
 
@@ -74,8 +75,15 @@ plus élévé dans la hiérarchie :
     }
 
     //! Indique le chemin d'accès aux resources images.
+    //! Le chemin est construit une seule fois, dès que le répertoire res a été trouvé.
     //! \return une chaîne de caractères contenant le chemin absolu du répertoire des images.
     QString imagesPath() {
-        return resourcesPath() + QString("images") + QDir::separator();
+        if (imagesLocation.isEmpty()) {
+            const QString resourcesDir = resourcesPath();
+            if (resourcesDir.isEmpty())
+                return QString("images") + QDir::separator();
+            imagesLocation = resourcesDir + QString("images") + QDir::separator();
+        }
+        return imagesLocation;
     }
 }
@@ -0,0 +1,50 @@
+/**
+  \file
+  \brief    Définition de la classe ScaledFrameCache.
+  \date     octobre 2026
+*/
+#include "scaledframecache.h"
+
+#include <QImage>
+
+QHash<ScaledFrameCache::Key, QPixmap> ScaledFrameCache::s_pixmaps;
+
+//! \return la taille, en pixels entiers, d'une image de la taille donnée agrandie
+//! du facteur donné. Chaque dimension mesure au moins un pixel.
+QSize ScaledFrameCache::scaledSize(const QSize& rSize, qreal scaleFactor) {
+    return QSize(qMax(1, qRound(rSize.width() * scaleFactor)),
+                 qMax(1, qRound(rSize.height() * scaleFactor)));
+}
+
+//! \return l'image d'animation donnée, agrandie du facteur donné (taille scaledSize()).
+//! L'image est calculée au premier appel, puis obtenue depuis le cache.
+//! \param rFrame       Image d'animation (zone d'une page d'atlas ou image indépendante).
+//! \param scaleFactor  Facteur d'agrandissement (strictement positif).
+//! \param mode         Mode de rééchantillonnage.
+QPixmap ScaledFrameCache::pixmap(const SpriteFrame& rFrame, qreal scaleFactor, Qt::TransformationMode mode) {
+    if (rFrame.isNull() || scaleFactor <= 0.0)
+        return QPixmap();
+
+    const Key key { rFrame.sourcePixmap().cacheKey(), rFrame.sourceRect(),
+                    scaledSize(rFrame.size(), scaleFactor), mode };
+    auto it = s_pixmaps.constFind(key);
+    if (it != s_pixmaps.constEnd())
+        return it.value();
+
+    const QImage sourceImage = rFrame.sourcePixmap().copy(rFrame.sourceRect()).toImage();
+    const QPixmap scaledPixmap = QPixmap::fromImage(sourceImage.scaled(key.scaledSize, Qt::IgnoreAspectRatio, mode));
+    s_pixmaps.insert(key, scaledPixmap);
+    return scaledPixmap;
+}
+
+//! \return le nombre d'images agrandies présentes dans le cache.
+int ScaledFrameCache::count() {
+    return static_cast<int>(s_pixmaps.count());
+}
+
+//! Vide le cache.
+//! Cette fonction doit être appelée avant la destruction de l'application,
+//! afin que les images ne soient pas détruites après QApplication.
+void ScaledFrameCache::clear() {
+    s_pixmaps.clear();
+}
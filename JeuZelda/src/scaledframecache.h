@@ -0,0 +1,62 @@
+/**
+  \file
+  \brief    Déclaration de la classe ScaledFrameCache.
+  \date     octobre 2026
+*/
+#ifndef SCALEDFRAMECACHE_H
+#define SCALEDFRAMECACHE_H
+
+#include <QHash>
+#include <QPixmap>
+#include <QRect>
+#include <QSize>
+
+#include "textureatlas.h"
+
+//! \brief Cache des images d'animation agrandies à l'avance.
+//!
+//! Presque tous les sprites du jeu sont agrandis (setScale()) d'un facteur constant.
+//! Dessiner une image agrandie par la transformation du sprite oblige le moteur de
+//! dessin à rééchantillonner l'image à chaque affichage. pixmap() retourne plutôt une
+//! copie de l'image d'animation déjà agrandie, que le sprite dessine telle quelle, pixel
+//! pour pixel (voir \ref sprite_prescaled).
+//!
+//! Chaque image agrandie est calculée une seule fois par combinaison (image source, zone,
+//! taille finale, mode de transformation), puis partagée par tous les sprites. Le mode
+//! Qt::FastTransformation (plus proche voisin) conserve l'aspect pixelisé des images
+//! du jeu.
+//!
+//! Comme les images sont des QPixmap, le cache ne doit être utilisé que depuis le thread
+//! de l'interface graphique. clear() doit être appelé avant la destruction de QApplication.
+class ScaledFrameCache
+{
+public:
+    static QSize scaledSize(const QSize& rSize, qreal scaleFactor);
+    static QPixmap pixmap(const SpriteFrame& rFrame, qreal scaleFactor,
+                          Qt::TransformationMode mode = Qt::FastTransformation);
+    static int count();
+    static void clear();
+
+private:
+    ScaledFrameCache() = delete;
+
+    struct Key {
+        qint64 sourceKey;
+        QRect sourceRect;
+        QSize scaledSize;
+        Qt::TransformationMode mode;
+
+        bool operator==(const Key& rOther) const {
+            return sourceKey == rOther.sourceKey && sourceRect == rOther.sourceRect
+                   && scaledSize == rOther.scaledSize && mode == rOther.mode;
+        }
+        friend size_t qHash(const Key& rKey, size_t seed = 0) {
+            return qHashMulti(seed, rKey.sourceKey, rKey.sourceRect.x(), rKey.sourceRect.y(),
+                              rKey.scaledSize.width(), rKey.scaledSize.height(), static_cast<int>(rKey.mode));
+        }
+    };
+
+    static QHash<Key, QPixmap> s_pixmaps;
+};
+
+#endif // SCALEDFRAMECACHE_H
@@ -0,0 +1,228 @@
+/**
+  \file
+  \brief    Définition de la classe SpatialHashGrid.
+  \date     octobre 2026
+*/
+#include "spatialhashgrid.h"
+
+#include <cmath>
+
+#include "sprite.h"
+
+const int NO_SLOT = -1;
+
+//! Construit une grille vide.
+//! \param cellSize  Taille (en pixels) du côté d'une cellule.
+SpatialHashGrid::SpatialHashGrid(int cellSize) {
+    m_cellSize = qMax(1, cellSize);
+    m_nextInsertionSerial = 0;
+    m_queryStamp = 0;
+}
+
+//! Destructeur : les sprites encore inscrits sont désinscrits (mais pas détruits).
+SpatialHashGrid::~SpatialHashGrid() {
+    clear();
+}
+
+//! Change la taille des cellules.
+//! Tous les sprites inscrits sont répartis à nouveau dans les cellules.
+//! \param cellSize  Taille (en pixels) du côté d'une cellule.
+void SpatialHashGrid::setCellSize(int cellSize) {
+    cellSize = qMax(1, cellSize);
+    if (cellSize == m_cellSize)
+        return;
+
+    m_cellSize = cellSize;
+    m_cells.clear();
+    for (Sprite* pSprite : std::as_const(m_sprites)) {
+        pSprite->m_spatialGridCells = cellRange(pSprite->m_spatialGridBounds);
+        addToCells(pSprite, pSprite->m_spatialGridCells);
+    }
+}
+
+//! \return la taille (en pixels) du côté d'une cellule.
+int SpatialHashGrid::cellSize() const {
+    return m_cellSize;
+}
+
+//! Inscrit le sprite donné dans la grille, à sa position actuelle.
+//! Si le sprite est déjà inscrit, sa position est simplement mise à jour.
+//! \param pSprite  Sprite à inscrire.
+void SpatialHashGrid::insert(Sprite* pSprite) {
+    Q_ASSERT(pSprite != nullptr);
+
+    if (pSprite->m_pSpatialGrid == this) {
+        update(pSprite);
+        return;
+    }
+
+    Q_ASSERT(pSprite->m_pSpatialGrid == nullptr);
+
+    pSprite->m_pSpatialGrid = this;
+    pSprite->m_spatialGridSlot = static_cast<int>(m_sprites.count());
+    pSprite->m_spatialGridSerial = m_nextInsertionSerial++;
+    pSprite->m_spatialGridQueryStamp = 0;
+    pSprite->m_spatialGridBounds = pSprite->sceneBoundingRect();
+    pSprite->m_spatialGridCells = cellRange(pSprite->m_spatialGridBounds);
+    m_sprites.append(pSprite);
+
+    addToCells(pSprite, pSprite->m_spatialGridCells);
+}
+
+//! Met à jour la position du sprite donné dans la grille.
+//! Les cellules ne sont modifiées que si le sprite a changé de cellule.
+//! \param pSprite  Sprite dont la géométrie a changé.
+void SpatialHashGrid::update(Sprite* pSprite) {
+    if (pSprite == nullptr || pSprite->m_pSpatialGrid != this)
+        return;
+
+    pSprite->m_spatialGridBounds = pSprite->sceneBoundingRect();
+    const QRect cells = cellRange(pSprite->m_spatialGridBounds);
+    if (cells == pSprite->m_spatialGridCells)
+        return;
+
+    removeFromCells(pSprite, pSprite->m_spatialGridCells);
+    pSprite->m_spatialGridCells = cells;
+    addToCells(pSprite, cells);
+}
+
+//! Retire le sprite donné de la grille.
+//! Si le sprite n'est pas inscrit, cette fonction ne fait rien.
+//! \param pSprite  Sprite à retirer.
+void SpatialHashGrid::remove(Sprite* pSprite) {
+    if (pSprite == nullptr || pSprite->m_pSpatialGrid != this)
+        return;
+
+    removeFromCells(pSprite, pSprite->m_spatialGridCells);
+
+    // Le dernier sprite prend la place de celui qui est retiré.
+    int slot = pSprite->m_spatialGridSlot;
+    Q_ASSERT(slot >= 0 && slot < m_sprites.count() && m_sprites[slot] == pSprite);
+    Sprite* pLastSprite = m_sprites.last();
+    m_sprites[slot] = pLastSprite;
+    pLastSprite->m_spatialGridSlot = slot;
+    m_sprites.removeLast();
+
+    pSprite->m_pSpatialGrid = nullptr;
+    pSprite->m_spatialGridSlot = NO_SLOT;
+}
+
+//! \return un booléen qui indique si le sprite donné est inscrit dans cette grille.
+bool SpatialHashGrid::contains(const Sprite* pSprite) const {
+    return pSprite != nullptr && pSprite->m_pSpatialGrid == this;
+}
+
+//! Retire tous les sprites de la grille et libère les cellules.
+void SpatialHashGrid::clear() {
+    for (Sprite* pSprite : std::as_const(m_sprites)) {
+        pSprite->m_pSpatialGrid = nullptr;
+        pSprite->m_spatialGridSlot = NO_SLOT;
+    }
+    m_sprites.clear();
+    m_cells.clear();
+}
+
+//! \return le nombre de sprites inscrits dans la grille.
+int SpatialHashGrid::spriteCount() const {
+    return static_cast<int>(m_sprites.count());
+}
+
+//! \return le nombre de cellules allouées.
+//! Les cellules vidées sont conservées, afin d'éviter des allocations lorsque
+//! des sprites y reviennent : elles ne sont libérées que par clear().
+int SpatialHashGrid::cellCount() const {
+    return static_cast<int>(m_cells.count());
+}
+
+//! Recherche les sprites dont le rectangle englobant intersecte le rectangle donné.
+//! Chaque sprite n'est ajouté qu'une seule fois au résultat, même s'il occupe
+//! plusieurs cellules. L'ordre des sprites trouvés n'est pas défini.
+//! \param rRect    Rectangle (coordonnées de la scène) à tester.
+//! \param rResult  Liste à laquelle sont ajoutés les sprites trouvés.
+void SpatialHashGrid::query(const QRectF& rRect, QVector<Sprite*>& rResult) const {
+    if (m_sprites.isEmpty())
+        return;
+
+    // Le tampon permet de reconnaître les sprites déjà visités lors de cette
+    // requête, sans avoir à construire d'ensemble temporaire.
+    if (++m_queryStamp == 0) {
+        for (Sprite* pSprite : m_sprites)
+            pSprite->m_spatialGridQueryStamp = 0;
+        m_queryStamp = 1;
+    }
+
+    const QRect cells = cellRange(rRect);
+    const qint64 rangeCellCount = static_cast<qint64>(cells.width()) * cells.height();
+
+    if (rangeCellCount > m_cells.count()) {
+        // Le rectangle recouvre plus de cellules que la grille n'en contient :
+        // il est moins coûteux de parcourir les cellules existantes.
+        for (auto it = m_cells.constBegin(); it != m_cells.constEnd(); ++it)
+            collectFromCell(it.value(), rRect, rResult);
+        return;
+    }
+
+    for (int row = cells.top(); row <= cells.bottom(); ++row) {
+        for (int column = cells.left(); column <= cells.right(); ++column) {
+            auto it = m_cells.constFind(cellKey(column, row));
+            if (it != m_cells.constEnd())
+                collectFromCell(it.value(), rRect, rResult);
+        }
+    }
+}
+
+//! \return la clé de la cellule se trouvant à la colonne et la ligne données.
+SpatialHashGrid::CellKey SpatialHashGrid::cellKey(int column, int row) {
+    return (static_cast<CellKey>(static_cast<quint32>(column)) << 32) | static_cast<quint32>(row);
+}
+
+//! \return les cellules (colonnes et lignes, bornes comprises) recouvertes par
+//! le rectangle donné.
+QRect SpatialHashGrid::cellRange(const QRectF& rRect) const {
+    const QRectF rect = rRect.normalized();
+    const int left = static_cast<int>(std::floor(rect.left() / m_cellSize));
+    const int top = static_cast<int>(std::floor(rect.top() / m_cellSize));
+    const int right = static_cast<int>(std::floor(rect.right() / m_cellSize));
+    const int bottom = static_cast<int>(std::floor(rect.bottom() / m_cellSize));
+    return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+//! Ajoute le sprite donné aux cellules données.
+void SpatialHashGrid::addToCells(Sprite* pSprite, const QRect& rCells) {
+    for (int row = rCells.top(); row <= rCells.bottom(); ++row) {
+        for (int column = rCells.left(); column <= rCells.right(); ++column)
+            m_cells[cellKey(column, row)].append(pSprite);
+    }
+}
+
+//! Retire le sprite donné des cellules données.
+void SpatialHashGrid::removeFromCells(Sprite* pSprite, const QRect& rCells) {
+    for (int row = rCells.top(); row <= rCells.bottom(); ++row) {
+        for (int column = rCells.left(); column <= rCells.right(); ++column) {
+            auto it = m_cells.find(cellKey(column, row));
+            if (it == m_cells.end())
+                continue;
+
+            QVector<Sprite*>& rCell = it.value();
+            const qsizetype index = rCell.indexOf(pSprite);
+            if (index < 0)
+                continue;
+
+            rCell[index] = rCell.last();
+            rCell.removeLast();
+        }
+    }
+}
+
+//! Ajoute au résultat les sprites de la cellule donnée qui n'ont pas encore été
+//! visités lors de cette requête et qui intersectent le rectangle donné.
+void SpatialHashGrid::collectFromCell(const QVector<Sprite*>& rCell, const QRectF& rRect, QVector<Sprite*>& rResult) const {
+    for (Sprite* pSprite : rCell) {
+        if (pSprite->m_spatialGridQueryStamp == m_queryStamp)
+            continue;
+
+        pSprite->m_spatialGridQueryStamp = m_queryStamp;
+        if (pSprite->m_spatialGridBounds.intersects(rRect))
+            rResult.append(pSprite);
+    }
+}
@@ -0,0 +1,73 @@
+/**
+  \file
+  \brief    Déclaration de la classe SpatialHashGrid.
+  \date     octobre 2026
+*/
+#ifndef SPATIALHASHGRID_H
+#define SPATIALHASHGRID_H
+
+#include <QHash>
+#include <QRect>
+#include <QRectF>
+#include <QVector>
+
+class Sprite;
+
+//! \brief Grille de hachage spatiale, utilisée pour accélérer la détection de collisions.
+//!
+//! L'espace est découpé en cellules carrées de taille identique (setCellSize()).
+//! Chaque sprite inscrit (insert()) est référencé dans toutes les cellules que
+//! recouvre son rectangle englobant (Sprite::sceneBoundingRect()).
+//! Seules les cellules occupées sont mémorisées, dans une table de hachage : la
+//! taille de l'espace n'a donc pas besoin d'être connue à l'avance.
+//!
+//! La grille est tenue à jour de façon incrémentale : lorsqu'un sprite inscrit se
+//! déplace ou change de géométrie, il appelle lui-même update(), qui ne modifie
+//! les cellules que si le sprite a changé de cellule.
+//!
+//! La méthode query() retourne, sans doublon, les sprites dont le rectangle
+//! englobant intersecte le rectangle donné. Le coût d'une requête dépend du nombre
+//! de sprites se trouvant à proximité, et non du nombre total de sprites.
+//!
+//! La taille des cellules devrait être du même ordre de grandeur que la taille des
+//! sprites : trop petite, un sprite occupe de nombreuses cellules ; trop grande,
+//! chaque cellule contient de nombreux sprites.
+class SpatialHashGrid
+{
+public:
+    static const int DEFAULT_CELL_SIZE = 64;
+
+    explicit SpatialHashGrid(int cellSize = DEFAULT_CELL_SIZE);
+    ~SpatialHashGrid();
+
+    void setCellSize(int cellSize);
+    int cellSize() const;
+
+    void insert(Sprite* pSprite);
+    void update(Sprite* pSprite);
+    void remove(Sprite* pSprite);
+    bool contains(const Sprite* pSprite) const;
+    void clear();
+
+    int spriteCount() const;
+    int cellCount() const;
+
+    void query(const QRectF& rRect, QVector<Sprite*>& rResult) const;
+
+private:
+    typedef quint64 CellKey;
+
+    static CellKey cellKey(int column, int row);
+    QRect cellRange(const QRectF& rRect) const;
+    void addToCells(Sprite* pSprite, const QRect& rCells);
+    void removeFromCells(Sprite* pSprite, const QRect& rCells);
+    void collectFromCell(const QVector<Sprite*>& rCell, const QRectF& rRect, QVector<Sprite*>& rResult) const;
+
+    int m_cellSize;
+    QHash<CellKey, QVector<Sprite*>> m_cells;
+    QVector<Sprite*> m_sprites;
+    quint64 m_nextInsertionSerial;
+    mutable quint32 m_queryStamp;
+};
+
+#endif // SPATIALHASHGRID_H
@@ -9,7 +9,10 @@
 #include <QDebug>
 #include <QPainter>
 
+#include "animationclock.h"
 #include "gamescene.h"
+#include "scaledframecache.h"
+#include "spatialhashgrid.h"
 #include "spritetickhandler.h"
 
 int Sprite::s_spriteCount = 0;
@@ -35,16 +38,43 @@ Sprite::Sprite(const QPixmap& rPixmap, QGraphicsItem* pParent) : QGraphicsPixmap
 
 //! Construit un sprite et l'initialise.
 //! Le sprite utilisera l'image fournie pour son apparence.
+//! L'image est obtenue depuis l'atlas de textures ou le cache AssetCache.
 //! \param rImagePath  Chemin vers l'image à utiliser pour l'apparence du sprite.
 //! \param pParent     Pointeur sur le parent (afin d'obtenir une destruction automatique de cet objet).
-Sprite::Sprite(const QString& rImagePath, QGraphicsItem* pParent) : Sprite(QPixmap(rImagePath), pParent) {
+Sprite::Sprite(const QString& rImagePath, QGraphicsItem* pParent) : QGraphicsPixmapItem(pParent) {
+    init();
+    addAnimationFrame(rImagePath);
+}
 
+//! Construit un sprite et l'initialise.
+//! Le sprite utilisera l'image donnée du registre AssetRegistry pour son apparence :
+//! aucun chemin n'est construit ni recherché.
+//! \param assetId  Image à utiliser pour l'apparence du sprite.
+//! \param pParent  Pointeur sur le parent (afin d'obtenir une destruction automatique de cet objet).
+Sprite::Sprite(AssetRegistry::AssetId assetId, QGraphicsItem* pParent) : QGraphicsPixmapItem(pParent) {
+    init();
+    addAnimationFrame(AssetRegistry::frame(assetId));
+}
+
+//! Construit un sprite et l'initialise.
+//! Le sprite affiche l'animation donnée, qu'il partage avec les autres sprites qui l'utilisent.
+//! \param rpClip   Animation à afficher (voir setAnimationClip()).
+//! \param pParent  Pointeur sur le parent (afin d'obtenir une destruction automatique de cet objet).
+Sprite::Sprite(const AnimationClipPointer& rpClip, QGraphicsItem* pParent) : QGraphicsPixmapItem(pParent) {
+    init();
+    setAnimationClip(rpClip);
 }
 
 //! Destructeur.
 Sprite::~Sprite() {
     emit spriteDestroyed(this);
 
+    if (m_pAnimationClock != nullptr)
+        m_pAnimationClock->unregisterSprite(this);
+
+    if (m_pSpatialGrid != nullptr)
+        m_pSpatialGrid->remove(this);
+
 #ifdef DEBUG_SPRITE_COUNT
     s_spriteCount--;
     displaySpriteCount();
@@ -58,7 +88,29 @@ Sprite::~Sprite() {
 //! Ajoute une image au cycle d'animation.
 //! \param rPixmap  Image à ajouter.
 void Sprite::addAnimationFrame(const QPixmap& rPixmap) {
-    m_animationList[m_currentAnimationIndex] << rPixmap;
+    addAnimationFrame(SpriteFrame(rPixmap));
+}
+
+//! Ajoute une image au cycle d'animation.
+//! L'image est obtenue depuis l'atlas de textures (TextureAtlas::frame()) ou, si elle
+//! n'en fait pas partie, depuis le cache AssetCache.
+//! \param rImagePath  Chemin de l'image à ajouter.
+void Sprite::addAnimationFrame(const QString& rImagePath) {
+    addAnimationFrame(TextureAtlas::frame(rImagePath));
+}
+
+//! Ajoute une image au cycle d'animation.
+//! L'animation du sprite étant immuable, elle est remplacée par une copie, propre
+//! à ce sprite, complétée de l'image donnée.
+//! \param rFrame  Image à ajouter (zone d'une page d'atlas ou image indépendante).
+void Sprite::addAnimationFrame(const SpriteFrame& rFrame) {
+    QVector<SpriteFrame> frames;
+    if (!m_pAnimationClip.isNull())
+        frames = m_pAnimationClip->frames();
+    frames << rFrame;
+    m_pAnimationClip = AnimationClip::create(frames);
+    if (isFramePrescaled())
+        ScaledFrameCache::pixmap(rFrame, m_frameScale, transformationMode());
     onNextAnimationFrame();
 }
 
@@ -66,14 +118,14 @@ void Sprite::addAnimationFrame(const QPixmap& rPixmap) {
 //! L'image doit avoir été au préalable ajoutée aux images d'animation avec addAnimationFrame().
 //! \param frameIndex   Index (à partir de zéro) de l'image à utiliser.
 void Sprite::setCurrentAnimationFrame(int frameIndex) {
-    if (m_animationList[m_currentAnimationIndex].isEmpty())
+    if (m_pAnimationClip.isNull() || m_pAnimationClip->isEmpty())
         return;
 
-    if (frameIndex < 0 || frameIndex >= m_animationList[m_currentAnimationIndex].count())
+    if (frameIndex < 0 || frameIndex >= m_pAnimationClip->frameCount())
         frameIndex = 0;
 
     m_currentAnimationFrame = frameIndex;
-    setPixmap(m_animationList[m_currentAnimationIndex][frameIndex]);
+    setFrame(m_pAnimationClip->frame(frameIndex));
 }
 
 //! \return l'index de l'image d'animation actuellement affichée.
@@ -84,9 +136,9 @@ int Sprite::currentAnimationFrame() const {
 //! Efface toutes les images du sprite.
 //! Le sprite devient invisible.
 void Sprite::clearAnimationFrames() {
-    m_animationList[m_currentAnimationIndex].clear();
+    m_pAnimationClip.reset();
     m_currentAnimationFrame = NO_CURRENT_FRAME;
-    setPixmap(QPixmap()); // On enlève l'image du sprite afin d'éviter toute confusion.
+    setFrame(SpriteFrame()); // On enlève l'image du sprite afin d'éviter toute confusion.
 }
 
 //! Affiche l'image suivante.
@@ -98,11 +150,9 @@ void Sprite::showNextAnimationFrame() {
 //! \param frameDuration   Durée d'une image en millisecondes.
 void Sprite::setAnimationSpeed(int frameDuration) {
     if (frameDuration <= 0)
-        m_animationTimer.stop();
-    else if (frameDuration != m_frameDuration) {
+        stopAnimation(IMMEDIATE_STOP);
+    else
         m_frameDuration = frameDuration;
-        m_animationTimer.setInterval(frameDuration);
-    }
 }
 
 //! Arrête l'animation.
@@ -114,9 +164,11 @@ void Sprite::stopAnimation(AnimationStopMode stopMode) {
     if (!isAnimationRunning())
         return;
 
-    if (stopMode == IMMEDIATE_STOP)
-        m_animationTimer.stop();
-    else if (stopMode == END_OF_CYCLE_STOP)
+    if (stopMode == IMMEDIATE_STOP) {
+        m_animationRunning = false;
+        m_animationStopLater = false;
+        updateAnimationClockRegistration();
+    } else if (stopMode == END_OF_CYCLE_STOP)
         m_animationStopLater = true;
 }
 
@@ -126,7 +178,9 @@ void Sprite::stopAnimation(AnimationStopMode stopMode) {
 void Sprite::startAnimation() {
     m_currentAnimationFrame = NO_CURRENT_FRAME;
     onNextAnimationFrame();
-    m_animationTimer.start();
+    m_animationElapsedTime = 0;
+    m_animationRunning = true;
+    updateAnimationClockRegistration();
 }
 
 //! Démarre l'animation à la vitesse donnée.
@@ -139,42 +193,36 @@ void Sprite::startAnimation(int frameDuration)  {
 
 //! \return un booléen qui indique si l'animation est en cours.
 bool Sprite::isAnimationRunning() const {
-    return m_animationTimer.isActive();
+    return m_animationRunning;
 }
 
-//! Ajoute une animation supplémentaire à ce sprite.
-//! \see clearAnimations()
-//! \see setActiveAnimation()
-//! \see animationCount()
-void Sprite::addAnimation() {
-    m_animationList.append(QList<QPixmap>());
-
-}
+//! Remplace l'animation du sprite par l'animation donnée, dont la première image est affichée.
+//! Si l'animation définit la durée de ses images, celle-ci remplace la vitesse d'animation
+//! du sprite (setAnimationSpeed()). L'état de l'animation (démarrée ou non) est conservé.
+//! \param rpClip  Animation à afficher, partagée avec les autres sprites qui l'utilisent.
+void Sprite::setAnimationClip(const AnimationClipPointer& rpClip) {
+    if (rpClip == m_pAnimationClip)
+        return;
 
-//! Efface toutes les animations d'un sprite mais en préserve une vide.
-void Sprite::clearAnimations() {
-    m_animationList.clear();
-    addAnimation();
-    m_currentAnimationIndex = 0;
-}
+    m_pAnimationClip = rpClip;
+    if (!m_pAnimationClip.isNull() && m_pAnimationClip->frameDuration() > 0)
+        m_frameDuration = m_pAnimationClip->frameDuration();
+    if (!m_pAnimationClip.isNull() && isFramePrescaled()) {
+        for (const SpriteFrame& rFrame : m_pAnimationClip->frames())
+            ScaledFrameCache::pixmap(rFrame, m_frameScale, transformationMode());
+    }
 
-//! \return le nombre d'animations que possède ce sprite.
-int Sprite::animationCount() const {
-    return m_animationList.count();
+    if (m_pAnimationClip.isNull() || m_pAnimationClip->isEmpty()) {
+        m_currentAnimationFrame = NO_CURRENT_FRAME;
+        setFrame(SpriteFrame());
+    } else {
+        setCurrentAnimationFrame(0);
+    }
 }
 
-//!
-//! Indique l'animation active utilisée pour l'affichage du sprite.
-//! Si l'index donné est invalide, c'est l'animation par défaut qui
-//! est activée.
-//! \param index Index de l'animation à activer.
-//!
-void Sprite::setActiveAnimation(int index) {
-    if (index < 0 || index >= m_animationList.count())
-        index = 0;
-
-    m_currentAnimationIndex = index;
-    setCurrentAnimationFrame(0);
+//! \return l'animation affichée par le sprite.
+AnimationClipPointer Sprite::animationClip() const {
+    return m_pAnimationClip;
 }
 
 //! Choisi si le signal animationFinished() doit être émis chaque fois que l'animation
@@ -194,13 +242,168 @@ bool Sprite::isEmitSignalEndOfAnimationEnabled() const {
 //! \param pScene  Scène à laquelle appartient ce sprite.
 void Sprite::setParentScene(GameScene* pScene) {
     m_pParentScene = pScene;
+    updateAnimationClockRegistration();
+}
+
+//! Change l'image affichée par le sprite.
+//! Masque QGraphicsPixmapItem::setPixmap() : l'image est affichée par le sprite
+//! lui-même, comme une image indépendante (voir setFrame()).
+//! \param rPixmap  Image à afficher.
+void Sprite::setPixmap(const QPixmap& rPixmap) {
+    setFrame(SpriteFrame(rPixmap));
+}
+
+//! Change l'image affichée par le sprite.
+//! Si la taille de l'image change, la grille de collisions de la scène est tenue à jour.
+//! \param rFrame  Image à afficher (zone d'une page d'atlas ou image indépendante).
+void Sprite::setFrame(const SpriteFrame& rFrame) {
+    const bool isSizeChanging = rFrame.size() != m_currentFrame.size();
+    if (isSizeChanging)
+        prepareGeometryChange();
+
+    m_currentFrame = rFrame;
+    m_scaledFramePixmap = isFramePrescaled() ? ScaledFrameCache::pixmap(rFrame, m_frameScale, transformationMode()) : QPixmap();
+    m_isFrameShapeValid = false;
+    update();
+
+    if (isSizeChanging)
+        updateSpatialGrid();
+}
+
+//! \return l'image actuellement affichée par le sprite.
+const SpriteFrame& Sprite::frame() const {
+    return m_currentFrame;
+}
+
+//! Change la façon dont la forme du sprite (shape()) est déterminée.
+//! Masque QGraphicsPixmapItem::setShapeMode() afin que la forme soit recalculée.
+//! \param mode  BoundingRectShape pour le rectangle de l'image, MaskShape ou
+//!              HeuristicMaskShape pour ses pixels non transparents.
+void Sprite::setShapeMode(ShapeMode mode) {
+    QGraphicsPixmapItem::setShapeMode(mode);
+    m_isFrameShapeValid = false;
+}
+
+//! Déplace le point chaud du sprite.
+//! Masque QGraphicsPixmapItem::setOffset() afin de tenir à jour la grille de
+//! collisions de la scène.
+//! \param rOffset  Décalage de l'image par rapport à la position du sprite.
+void Sprite::setOffset(const QPointF& rOffset) {
+    QGraphicsPixmapItem::setOffset(rOffset);
+    m_isFrameShapeValid = false;
+    updateSpatialGrid();
+}
+
+//! Change le facteur de grossissement du sprite.
+//! Masque QGraphicsItem::setScale() : si le sprite est agrandi à l'avance
+//! (setPrescaledRenderingEnabled()), sa transformation n'est pas agrandie, mais ses
+//! images d'animation sont remplacées par leurs copies agrandies (voir \ref sprite_prescaled).
+//! \param factor  Facteur de grossissement.
+void Sprite::setScale(qreal factor) {
+    if (!m_isPrescaledRenderingEnabled || factor <= 0.0) {
+        setFrameScale(1.0);
+        QGraphicsPixmapItem::setScale(factor);
+        return;
+    }
+
+    QGraphicsPixmapItem::setScale(1.0);
+    setFrameScale(factor);
 }
 
-#ifdef QT_DEBUG
-//! Dessine le sprite, avec sa boundingbox qui l'entoure.
+//! \return le facteur de grossissement du sprite, qu'il soit appliqué par sa
+//! transformation ou par ses images agrandies à l'avance.
+qreal Sprite::scale() const {
+    return m_frameScale * QGraphicsPixmapItem::scale();
+}
+
+//! Active ou désactive l'agrandissement à l'avance des images du sprite (voir
+//! \ref sprite_prescaled). Il est activé par défaut.
+//! Le facteur de grossissement actuel du sprite est conservé.
+//! \param enabled  Vrai pour agrandir les images à l'avance, faux pour agrandir
+//!                 le sprite par sa transformation.
+void Sprite::setPrescaledRenderingEnabled(bool enabled) {
+    if (enabled == m_isPrescaledRenderingEnabled)
+        return;
+
+    const qreal currentScale = scale();
+    m_isPrescaledRenderingEnabled = enabled;
+    setScale(currentScale);
+}
+
+//! \return un booléen qui indique si les images du sprite sont agrandies à l'avance.
+bool Sprite::isPrescaledRenderingEnabled() const {
+    return m_isPrescaledRenderingEnabled;
+}
+
+//! \return le rectangle occupé par l'image actuelle, dans le repère du sprite.
+//! Si l'image est agrandie à l'avance, le rectangle est celui de l'image agrandie,
+//! dont le point chaud est agrandi du même facteur.
+QRectF Sprite::boundingRect() const {
+    if (m_currentFrame.isNull())
+        return QRectF();
+    if (isFramePrescaled())
+        return QRectF(offset() * m_frameScale, QSizeF(ScaledFrameCache::scaledSize(m_currentFrame.size(), m_frameScale)));
+    return QRectF(offset(), QSizeF(m_currentFrame.size()));
+}
+
+//! \return la forme de l'image actuelle, dans le repère du sprite : ses pixels non
+//! transparents ou son rectangle, selon shapeMode().
+//! La forme est mémorisée jusqu'au prochain changement d'image ou de point chaud.
+QPainterPath Sprite::shape() const {
+    if (!m_isFrameShapeValid) {
+        m_frameShape = QPainterPath();
+        if (shapeMode() == BoundingRectShape)
+            m_frameShape.addRect(boundingRect());
+        else if (isFramePrescaled() && !m_currentFrame.isNull()) {
+            // La forme de l'image d'origine est agrandie comme ses pixels.
+            const QRectF scaledRect = boundingRect();
+            const QTransform frameToSprite = QTransform::fromTranslate(scaledRect.x(), scaledRect.y())
+                                                 .scale(scaledRect.width() / m_currentFrame.size().width(),
+                                                        scaledRect.height() / m_currentFrame.size().height());
+            m_frameShape = frameToSprite.map(m_currentFrame.shape());
+        }
+        else if (!m_currentFrame.isNull())
+            m_frameShape = m_currentFrame.shape().translated(offset());
+        m_isFrameShapeValid = true;
+    }
+    return m_frameShape;
+}
+
+//! Change le type de ce sprite.
+//! Si le sprite fait partie d'une scène, celle-ci met à jour sa liste des sprites
+//! par type (GameScene::spritesOfType()).
+//! \param spriteType  Type du sprite (-1 : aucun type).
+void Sprite::setSpriteType(int spriteType) {
+    if (spriteType == m_customType)
+        return;
+
+    int previousType = m_customType;
+    m_customType = spriteType;
+
+    if (m_pParentScene != nullptr && scene() == m_pParentScene)
+        m_pParentScene->onSpriteTypeChanged(this, previousType);
+}
+
+//! \return le type de ce sprite, ou -1 si aucun type ne lui a été attribué.
+int Sprite::spriteType() const {
+    return m_customType;
+}
+
+//! Dessine l'image actuelle du sprite : sa copie agrandie à l'avance, telle quelle, ou
+//! sa zone de la page d'atlas ou de l'image indépendante.
+//! En mode debug, dessine également sa boundingbox qui l'entoure.
 void Sprite::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget) {
-    QGraphicsPixmapItem::paint(pPainter, pOption, pWidget);
+    Q_UNUSED(pOption)
+    Q_UNUSED(pWidget)
+
+    if (!m_scaledFramePixmap.isNull())
+        pPainter->drawPixmap(boundingRect().topLeft(), m_scaledFramePixmap);
+    else if (!m_currentFrame.isNull()) {
+        pPainter->setRenderHint(QPainter::SmoothPixmapTransform, transformationMode() == Qt::SmoothTransformation);
+        pPainter->drawPixmap(boundingRect(), m_currentFrame.sourcePixmap(), QRectF(m_currentFrame.sourceRect()));
+    }
 
+#ifdef QT_DEBUG
 #ifdef DEBUG_BRECT
     pPainter->setPen(Qt::cyan);
     pPainter->drawRect(this->boundingRect());
@@ -221,7 +424,7 @@ void Sprite::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption,
 
         // Afficher la position x,y selon le système de coordonnées global
         QFont font = pPainter->font();
-        font.setPixelSize(static_cast<int>(10.0/scale()));
+        font.setPixelSize(static_cast<int>(10.0/QGraphicsPixmapItem::scale()));
         font.setStyleStrategy(QFont::NoAntialias);
         pPainter->setFont(font);
         pPainter->setPen(Qt::white);
@@ -229,7 +432,7 @@ void Sprite::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption,
 
         // Suppression de la mise à l'échelle
         pPainter->save();
-        pPainter->scale(1.0/this->scale(), 1.0/this->scale());
+        pPainter->scale(1.0/QGraphicsPixmapItem::scale(), 1.0/QGraphicsPixmapItem::scale());
 
         // Afficher le point chaud
         pPainter->setPen(Qt::yellow);
@@ -239,8 +442,8 @@ void Sprite::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption,
         // Rétablissement de la mise à l'échelle
         pPainter->restore();
     }
-}
 #endif
+}
 
 //! Enregistre ce sprite auprès de la scène afin qu'il soit informé de la
 //! cadence et que la fonction tick() soit appelée en cadence.
@@ -359,6 +562,74 @@ QList<Sprite*> Sprite::collidingSprites(const QPainterPath& rShape) const {
     return collidingSpriteList;
 }
 
+//! Informe la grille de collisions de la scène que la géométrie du sprite a changé.
+QVariant Sprite::itemChange(GraphicsItemChange change, const QVariant& rValue) {
+    switch (change) {
+    case ItemPositionChange:
+        // Un sprite retiré de sa scène (par exemple recyclé par GamePools) n'est pas suivi.
+        if (m_pParentScene != nullptr && scene() != nullptr)
+            m_pParentScene->onSpriteAboutToMove(this);
+        break;
+    case ItemTransformHasChanged:
+        // Le décalage d'affichage (interpolation) ne doit pas déplacer le sprite dans la grille.
+        if (!m_applyingRenderOffset)
+            updateSpatialGrid();
+        break;
+    case ItemPositionHasChanged:
+    case ItemRotationHasChanged:
+    case ItemScaleHasChanged:
+    case ItemTransformOriginPointHasChanged:
+        updateSpatialGrid();
+        break;
+    default:
+        break;
+    }
+
+    return QGraphicsPixmapItem::itemChange(change, rValue);
+}
+
+//! Décale l'affichage du sprite, sans changer sa position (pos()) ni sa place dans
+//! la grille spatiale de la scène.
+//! Le décalage est appliqué avec la transformation du sprite, que Qt combine après la
+//! rotation et la mise à l'échelle : il s'exprime donc directement dans le repère du parent.
+//! \param rOffset  Décalage, dans le système de coordonnées du parent du sprite.
+void Sprite::setRenderOffset(const QPointF& rOffset) {
+    m_applyingRenderOffset = true;
+    setTransform(QTransform::fromTranslate(rOffset.x(), rOffset.y()));
+    m_applyingRenderOffset = false;
+    m_hasRenderOffset = true;
+}
+
+//! Efface le décalage d'affichage du sprite (setRenderOffset()).
+void Sprite::clearRenderOffset() {
+    if (!m_hasRenderOffset)
+        return;
+
+    m_applyingRenderOffset = true;
+    setTransform(QTransform());
+    m_applyingRenderOffset = false;
+    m_hasRenderOffset = false;
+}
+
+//! Change le facteur d'agrandissement à l'avance des images du sprite (1 : images d'origine).
+//! Les copies agrandies de toutes ses images d'animation sont préparées immédiatement.
+//! \param scaleFactor  Facteur d'agrandissement des images.
+void Sprite::setFrameScale(qreal scaleFactor) {
+    if (scaleFactor == m_frameScale)
+        return;
+
+    prepareGeometryChange();
+    m_frameScale = scaleFactor;
+    if (isFramePrescaled() && !m_pAnimationClip.isNull()) {
+        for (const SpriteFrame& rFrame : m_pAnimationClip->frames())
+            ScaledFrameCache::pixmap(rFrame, m_frameScale, transformationMode());
+    }
+    m_scaledFramePixmap = isFramePrescaled() ? ScaledFrameCache::pixmap(m_currentFrame, m_frameScale, transformationMode()) : QPixmap();
+    m_isFrameShapeValid = false;
+    update();
+    updateSpatialGrid();
+}
+
 //! Initialise le sprite.
 void Sprite::init() {
     m_pTickHandler = nullptr;
@@ -366,13 +637,11 @@ void Sprite::init() {
     m_emitSignalEOA = false;
     m_frameDuration = 0;
     m_currentAnimationFrame = NO_CURRENT_FRAME;
-    m_currentAnimationIndex = 0;
-
-    // Par défaut, le sprite possède une (unique) liste d'animation
-    addAnimation();
 
     m_customType = -1;
-    connect(&m_animationTimer, &QTimer::timeout, this, &Sprite::onNextAnimationFrame);
+
+    // Nécessaire pour que itemChange() soit informé des déplacements du sprite.
+    setFlag(ItemSendsGeometryChanges);
 
 #ifdef DEBUG_SPRITE_COUNT
     s_spriteCount++;
@@ -380,30 +649,76 @@ void Sprite::init() {
 #endif
 }
 
+//! Fait avancer l'animation du temps donné.
+//! Appelé par l'horloge d'animation de la scène (AnimationClock) à chaque tick.
+//! Si le temps écoulé couvre plusieurs images, l'animation avance d'autant
+//! d'images, afin que sa vitesse ne dépende pas de la fréquence des ticks.
+//! \param elapsedTimeInMilliseconds  Temps écoulé depuis l'appel précédent.
+void Sprite::advanceAnimation(long long elapsedTimeInMilliseconds) {
+    if (m_frameDuration <= 0)
+        return;
+
+    m_animationElapsedTime += elapsedTimeInMilliseconds;
+    while (m_animationRunning && m_animationElapsedTime >= m_frameDuration) {
+        m_animationElapsedTime -= m_frameDuration;
+        onNextAnimationFrame();
+    }
+}
+
+//! Inscrit ce sprite auprès de l'horloge d'animation de sa scène si son animation
+//! est en cours, ou l'en désinscrit dans le cas contraire.
+void Sprite::updateAnimationClockRegistration() {
+    AnimationClock* pClock = nullptr;
+    if (m_animationRunning && m_pParentScene != nullptr && scene() == m_pParentScene)
+        pClock = m_pParentScene->animationClock();
+
+    if (pClock == m_pAnimationClock)
+        return;
+
+    if (m_pAnimationClock != nullptr)
+        m_pAnimationClock->unregisterSprite(this);
+    if (pClock != nullptr)
+        pClock->registerSprite(this);
+}
+
+//! Met à jour la position du sprite dans la grille de collisions de sa scène.
+void Sprite::updateSpatialGrid() {
+    if (m_pSpatialGrid != nullptr)
+        m_pSpatialGrid->update(this);
+}
+
 //! Affiche l'image suivante de l'animation.
 //! Si la dernière image est affichée, l'animation reprend au début et,
 //! selon la configuration, le signal animationFinished() est émis.
 void Sprite::onNextAnimationFrame() {
-    if (m_animationList[m_currentAnimationIndex].isEmpty()) {
+    if (m_pAnimationClip.isNull() || m_pAnimationClip->isEmpty()) {
         m_currentAnimationFrame = NO_CURRENT_FRAME;
         return;
     }
 
+    // Le signal animationFinished() peut conduire à changer d'animation.
+    const AnimationClipPointer pClip = m_pAnimationClip;
     int PreviousAnimationFrame = m_currentAnimationFrame;
     ++m_currentAnimationFrame;
-    if (m_currentAnimationFrame >= m_animationList[m_currentAnimationIndex].count()) {
-        m_currentAnimationFrame = 0;
+    if (m_currentAnimationFrame >= pClip->frameCount()) {
+        // Une animation jouée une seule fois s'arrête sur sa dernière image.
+        if (pClip->loopMode() == AnimationClip::ONCE) {
+            m_currentAnimationFrame = pClip->frameCount() - 1;
+            stopAnimation(IMMEDIATE_STOP);
+        } else {
+            m_currentAnimationFrame = 0;
+        }
         if (m_emitSignalEOA)
             emit animationFinished();
         if (m_animationStopLater) {
             m_animationStopLater = false;
             stopAnimation(IMMEDIATE_STOP);
         }
+        if (m_pAnimationClip != pClip)
+            return;
     }
-    if (PreviousAnimationFrame != m_currentAnimationFrame) {
-        setPixmap(m_animationList[m_currentAnimationIndex][m_currentAnimationFrame]);
-        update();
-    }
+    if (PreviousAnimationFrame != m_currentAnimationFrame)
+        setFrame(pClip->frame(m_currentAnimationFrame));
 }
 
 #ifdef QT_DEBUG
@@ -19,9 +19,14 @@
 #include <QGraphicsPixmapItem>
 #include <QObject>
 #include <QPixmap>
-#include <QTimer>
 
+#include "animationclip.h"
+#include "assetregistry.h"
+#include "textureatlas.h"
+
+class AnimationClock;
 class GameScene;
+class SpatialHashGrid;
 class SpriteTickHandler;
 
 //! \brief Classe qui représente un élément d'animation graphique 2D.
@@ -57,9 +62,26 @@ class SpriteTickHandler;
 //! d'apparence. Il est également possible de faire changer automatiquement ces
 //! images dans le but d'obtenir un sprite animé.
 //!
+//! Les images d'un sprite forment son animation (AnimationClip), une suite d'images
+//! immuable qui peut être partagée par de nombreux sprites : setAnimationClip() la
+//! remplace, par exemple par une animation du jeu (GameClips). Le sprite ne mémorise
+//! que cette animation, l'image affichée et le temps écoulé depuis son affichage.
+//!
 //! La méthode addAnimationFrame() permet d'ajouter une image au sprite.
 //! Si plusieurs images sont ajoutées, elles sont conservées dans une liste qui
-//! préserve l'ordre d'ajout des images.
+//! préserve l'ordre d'ajout des images. Comme une animation ne change pas, chaque
+//! ajout remplace l'animation du sprite par une nouvelle animation qui lui est propre :
+//! les sprites nombreux utilisent plutôt une animation partagée.
+//! Lorsque l'image est donnée par son chemin, elle est obtenue depuis l'atlas de
+//! textures (TextureAtlas) ou, si elle n'en fait pas partie, depuis le cache
+//! AssetCache : une même image n'est ainsi décodée qu'une seule fois, quel que
+//! soit le nombre de sprites qui l'utilisent.
+//!
+//! Chaque image est mémorisée sous la forme d'une SpriteFrame : une zone d'une page
+//! d'atlas ou d'une image indépendante. Le sprite dessine lui-même cette zone (paint())
+//! et en déduit son rectangle englobant (boundingRect()) et sa forme (shape()). La
+//! forme d'une image de l'atlas est calculée une seule fois, lors de la construction
+//! de l'atlas. L'image de QGraphicsPixmapItem (pixmap()) n'est donc pas utilisée.
 //!
 //! La méthode setCurrentAnimationFrame() permet de spécifier quelle image doit
 //! être affichée (l'indice de la première image est 0). La méthode currentAnimationFrame()
@@ -71,6 +93,11 @@ class SpriteTickHandler;
 //! La vitesse d'animation peut être réglée avec setAnimationSpeed() ou au moment
 //! de démarrer l'animation.
 //!
+//! L'animation est cadencée par l'horloge d'animation (AnimationClock) de la scène
+//! à laquelle appartient le sprite : elle ne progresse donc que lorsque le sprite
+//! fait partie d'une scène dont la cadence est active, et suit le temps écoulé
+//! entre les ticks.
+//!
 //! Il est également possible de demander au sprite d'émettre un signal chaque fois
 //! que l'animation est terminée, avec la méthode setEmitSignalEndOfAnimationEnabled().
 //! Cela permet par exemple de connecter ce signal au slot deleteLater() du même
@@ -100,6 +127,21 @@ class SpriteTickHandler;
 //!
 //! Avant d'être détruit, un sprite émet le signal spriteDestroyed().
 //!
+//! La scène référence ses sprites dans une grille de hachage spatiale
+//! (SpatialHashGrid), utilisée pour la détection de collisions. Le sprite tient
+//! lui-même la grille à jour lorsque sa géométrie change (position, transformation,
+//! image ou point chaud).
+//!
+//! Entre deux ticks, l'affichage du sprite peut être interpolé entre ses deux dernières
+//! positions (voir GameScene::interpolateRendering()). Ce décalage d'affichage passe par
+//! la transformation du sprite (transform()) : il ne modifie pas sa position (pos()) et
+//! il est effacé avant chaque tick et dès que le sprite est déplacé. La méthode setTransform()
+//! ne doit donc pas être utilisée pour les sprites d'une scène.
+//!
+//! Un type (entier libre, par exemple GameCore::SpriteType) peut être attribué au
+//! sprite avec setSpriteType(). La scène tient à jour la liste des sprites de chaque
+//! type (GameScene::spritesOfType()), ce qui évite de parcourir tous ses éléments.
+//!
 //! \section sprite_pos Positionnement du sprite
 //! Lorsqu'un sprite est positionné sur la scène au moyen de setPos(), c'est en réalité
 //! le coin supérieur gauche du sprite qui est positionné à la coordonnée donnée.
@@ -120,6 +162,24 @@ class SpriteTickHandler;
 //!
 //! Le point de transformation peut être défini avec setTransformOriginPoint().
 //!
+//! \section sprite_prescaled Images agrandies à l'avance
+//!
+//! Par défaut (setPrescaledRenderingEnabled()), setScale() n'agrandit pas le sprite par
+//! sa transformation : ses images d'animation sont remplacées par des copies agrandies
+//! à l'avance, au plus proche voisin (ScaledFrameCache). Le sprite les dessine alors
+//! pixel pour pixel, sans transformation, ce qui évite au moteur de dessin de
+//! rééchantillonner l'image à chaque affichage. Les copies de toutes les images d'animation
+//! sont préparées dès l'appel à setScale() (ou à addAnimationFrame()), pas lors du dessin.
+//!
+//! La géométrie reste celle d'un sprite agrandi par sa transformation : scale() retourne
+//! le facteur demandé, le point chaud (offset()) est exprimé dans le repère de l'image
+//! d'origine, et boundingRect() et shape() couvrent l'image agrandie. La taille de
+//! l'image agrandie est arrondie au pixel près (ScaledFrameCache::scaledSize()).
+//!
+//! La mise à l'échelle d'un sprite agrandi à l'avance se fait toujours depuis son point
+//! chaud : le point de transformation (setTransformOriginPoint()) n'est utilisé que
+//! pour la rotation.
+//!
 //! \section tick_handler Le gestionnaire de cadence
 //!
 //! Un sprite peut être déplacé de plusieurs façons différents au sein d'une scène.
@@ -164,9 +224,13 @@ public:
     Sprite(QGraphicsItem* pParent = nullptr);
     Sprite(const QPixmap& rPixmap, QGraphicsItem* pParent = nullptr);
     Sprite(const QString& rImagePath, QGraphicsItem* pParent = nullptr);
+    Sprite(AssetRegistry::AssetId assetId, QGraphicsItem* pParent = nullptr);
+    Sprite(const AnimationClipPointer& rpClip, QGraphicsItem* pParent = nullptr);
     virtual ~Sprite() override;
 
     void addAnimationFrame(const QPixmap& rPixmap);
+    void addAnimationFrame(const QString& rImagePath);
+    void addAnimationFrame(const SpriteFrame& rFrame);
     void setCurrentAnimationFrame(int frameIndex);
     int currentAnimationFrame() const;
     void clearAnimationFrames();
@@ -177,10 +241,8 @@ public:
     void startAnimation(int frameDuration);
     bool isAnimationRunning() const;
 
-    void addAnimation();
-    void clearAnimations();
-    int animationCount() const;
-    void setActiveAnimation(int index);
+    void setAnimationClip(const AnimationClipPointer& rpClip);
+    AnimationClipPointer animationClip() const;
 
     void setEmitSignalEndOfAnimationEnabled(bool enabled);
     bool isEmitSignalEndOfAnimationEnabled() const;
@@ -196,6 +258,20 @@ public:
 
     void setParentScene(GameScene* pScene);
 
+    void setPixmap(const QPixmap& rPixmap);
+    void setFrame(const SpriteFrame& rFrame);
+    const SpriteFrame& frame() const;
+    void setShapeMode(ShapeMode mode);
+    void setOffset(const QPointF& rOffset);
+    void setOffset(qreal x, qreal y) { setOffset(QPointF(x, y)); }
+    void setScale(qreal factor);
+    qreal scale() const;
+    void setPrescaledRenderingEnabled(bool enabled);
+    bool isPrescaledRenderingEnabled() const;
+
+    void setSpriteType(int spriteType);
+    int spriteType() const;
+
     enum { SpriteItemType = UserType + 1 };
     virtual int type() const override { return SpriteItemType; }
 
@@ -211,9 +287,9 @@ public:
 
     void setDebugModeEnabled(bool enabled);
 
-#ifdef QT_DEBUG
+    virtual QRectF boundingRect() const override;
+    virtual QPainterPath shape() const override;
     virtual void paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget = nullptr) override;
-#endif
 
 signals:
     void animationFinished();
@@ -228,30 +304,64 @@ signals:
     void spriteDestroyed(Sprite*);
 
 protected:
+    virtual QVariant itemChange(GraphicsItemChange change, const QVariant& rValue) override;
+
     QList<Sprite*> collidingSprites() const;
     QList<Sprite*> collidingSprites(const QRectF& rRect) const;
     QList<Sprite*> collidingSprites(const QPainterPath& rShape) const;
     GameScene* m_pParentScene;
 
 private:
+    friend class AnimationClock;
+    friend class GameScene;
+    friend class SpatialHashGrid;
+
     static int s_spriteCount;
     static void displaySpriteCount();
 
     void init();
+    void advanceAnimation(long long elapsedTimeInMilliseconds);
+    void updateAnimationClockRegistration();
+    void updateSpatialGrid();
+    void setRenderOffset(const QPointF& rOffset);
+    void clearRenderOffset();
+    bool isFramePrescaled() const { return m_frameScale != 1.0; }
+    void setFrameScale(qreal scaleFactor);
 
     SpriteTickHandler* m_pTickHandler;
 
-    QTimer m_animationTimer;
+    AnimationClock* m_pAnimationClock = nullptr;
+    int m_animationClockSlot = -1;
+    long long m_animationElapsedTime = 0;
+    bool m_animationRunning = false;
+
+    SpatialHashGrid* m_pSpatialGrid = nullptr;
+    int m_spatialGridSlot = -1;
+    QRectF m_spatialGridBounds;
+    QRect m_spatialGridCells;
+    quint64 m_spatialGridSerial = 0;
+    quint32 m_spatialGridQueryStamp = 0;
+
+    int m_interpolationSlot = -1;
+    QPointF m_previousSimulationPos;
+    bool m_hasRenderOffset = false;
+    bool m_applyingRenderOffset = false;
 
     bool m_emitSignalEOA;
     bool m_animationStopLater = false;
 
-    QList<QList <QPixmap>> m_animationList;
+    AnimationClipPointer m_pAnimationClip;
+    SpriteFrame m_currentFrame;
+    mutable QPainterPath m_frameShape;
+    mutable bool m_isFrameShapeValid = false;
+    bool m_isPrescaledRenderingEnabled = true;
+    qreal m_frameScale = 1.0;
+    QPixmap m_scaledFramePixmap;
     int m_frameDuration;
     int m_currentAnimationFrame;
-    int m_currentAnimationIndex;
 
     int m_customType;
+    int m_typeRegistrySlot = -1;
 
     bool m_debugMode = false;
 
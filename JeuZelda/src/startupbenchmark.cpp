@@ -0,0 +1,111 @@
+/**
+  \file
+  \brief    Définition de la classe StartupBenchmark.
+  \date     octobre 2026
+*/
+#include "startupbenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <QRegularExpression>
+#include <QtDebug>
+
+#include "startuptimer.h"
+
+//! Temps maximal accordé à un lancement, en millisecondes.
+const int LAUNCH_TIMEOUT = 60000;
+
+//! Lance le jeu launchCount fois et écrit dans la sortie de log la mesure du premier
+//! lancement (à froid, une seule mesure), puis la distribution des suivants (à chaud).
+//! \param launchCount       Nombre de lancements.
+//! \param rExtraArguments   Arguments ajoutés à chaque lancement (par exemple `--no-asset-pack`).
+//! \return 0 si tous les lancements ont réussi, 1 sinon.
+int StartupBenchmark::run(int launchCount, const QStringList& rExtraArguments) {
+    const QStringList arguments = QStringList({ "--startup-report", "-platform", "offscreen" }) + rExtraArguments;
+
+    qInfo().noquote() << QString("Démarrage : %1 lancement(s) de %2 %3")
+                         .arg(launchCount).arg(QCoreApplication::applicationFilePath(), arguments.join(' '));
+
+    QVector<double> warmFirstFrameTimes;
+    QVector<double> warmProcessTimes;
+    int failedCount = 0;
+    for (int i = 0; i < launchCount; i++) {
+        Launch result;
+        if (!launch(arguments, result)) {
+            failedCount++;
+            continue;
+        }
+        qInfo().noquote() << QString("Lancement %1 : première image %2 ms, processus %3 ms")
+                             .arg(i + 1, 3).arg(result.firstFrameMilliseconds, 9, 'f', 3)
+                             .arg(result.processMilliseconds, 9, 'f', 3);
+        if (i == 0) {
+            // Une seule mesure : elle n'est pas comparable à la distribution à chaud.
+            qInfo().noquote() << QString("À froid (1er lancement, 1 seule mesure) | première image %1 ms | processus %2 ms")
+                                 .arg(result.firstFrameMilliseconds, 0, 'f', 3).arg(result.processMilliseconds, 0, 'f', 3);
+        } else {
+            warmFirstFrameTimes << result.firstFrameMilliseconds;
+            warmProcessTimes << result.processMilliseconds;
+        }
+    }
+
+    qInfo().noquote() << "Pour une distribution à froid, relancer `--bench-startup 1` plusieurs fois en vidant"
+                         " le cache de fichiers du système avant chaque exécution (voir StartupBenchmark).";
+    if (!warmFirstFrameTimes.isEmpty()) {
+        qInfo().noquote() << "À chaud   | première image" << distribution(warmFirstFrameTimes);
+        qInfo().noquote() << "À chaud   | processus     " << distribution(warmProcessTimes);
+    }
+    if (failedCount > 0)
+        qWarning() << failedCount << "lancement(s) en échec";
+    return failedCount == 0 ? 0 : 1;
+}
+
+//! Lance le jeu une fois et relève ses temps de démarrage.
+//! \param rArguments  Arguments du lancement.
+//! \param rLaunch     Mesures du lancement, remplies en cas de succès.
+//! \return un booléen à faux si le jeu n'a pas pu être lancé, ne s'est pas terminé
+//! normalement ou n'a pas écrit de rapport de démarrage.
+bool StartupBenchmark::launch(const QStringList& rArguments, Launch& rLaunch) {
+    QProcess process;
+    process.setProcessChannelMode(QProcess::SeparateChannels);
+
+    QElapsedTimer timer;
+    timer.start();
+    process.start(QCoreApplication::applicationFilePath(), rArguments);
+    if (!process.waitForFinished(LAUNCH_TIMEOUT) || process.exitStatus() != QProcess::NormalExit
+            || process.exitCode() != 0) {
+        qWarning() << "Lancement en échec :" << process.errorString();
+        process.kill();
+        process.waitForFinished();
+        return false;
+    }
+    rLaunch.processMilliseconds = timer.nsecsElapsed() / 1.0e6;
+
+    // Ligne du rapport de StartupTimer : « <étape> <temps> ms  (+<durée>) ».
+    const QString firstFrameName = StartupTimer::milestoneName(StartupTimer::FIRST_FRAME_PAINTED);
+    const QRegularExpression linePattern("^\\s*" + QRegularExpression::escape(firstFrameName) + "\\s+([0-9.]+) ms",
+                                         QRegularExpression::MultilineOption);
+    const QRegularExpressionMatch match = linePattern.match(QString::fromUtf8(process.readAllStandardOutput()));
+    if (!match.hasMatch()) {
+        qWarning() << "Rapport de démarrage absent de la sortie du lancement";
+        return false;
+    }
+    rLaunch.firstFrameMilliseconds = match.captured(1).toDouble();
+    return true;
+}
+
+//! \return la distribution des valeurs données (en millisecondes) : minimum, médiane,
+//! percentile 95 et maximum.
+QString StartupBenchmark::distribution(QVector<double> values) {
+    std::sort(values.begin(), values.end());
+    auto percentile = [&values](double rank) {
+        const int index = qBound(0, static_cast<int>(std::ceil(rank * values.count())) - 1, static_cast<int>(values.count()) - 1);
+        return values.at(index);
+    };
+    return QString("| min %1 ms | p50 %2 ms | p95 %3 ms | max %4 ms | %5 mesure(s)")
+            .arg(values.first(), 0, 'f', 3).arg(percentile(0.50), 0, 'f', 3)
+            .arg(percentile(0.95), 0, 'f', 3).arg(values.last(), 0, 'f', 3).arg(values.count());
+}
@@ -0,0 +1,58 @@
+/**
+  \file
+  \brief    Déclaration de la classe StartupBenchmark.
+  \date     octobre 2026
+*/
+#ifndef STARTUPBENCHMARK_H
+#define STARTUPBENCHMARK_H
+
+#include <QStringList>
+#include <QVector>
+
+//! \brief Banc d'essai du démarrage : lance le jeu plusieurs fois et mesure le temps
+//! jusqu'à la première image.
+//!
+//! Le jeu est relancé launchCount fois, sans affichage (plateforme "offscreen"), avec
+//! l'option `--startup-report` : chaque lancement écrit le rapport de StartupTimer dès
+//! que sa première image est dessinée, puis se termine. Le banc d'essai relève, pour
+//! chaque lancement, le temps jusqu'à la première image (selon le rapport) et la durée
+//! totale du processus (mesurée de l'extérieur, chargement du programme compris).
+//!
+//! Le premier lancement est compté « à froid » : les fichiers du programme, des
+//! bibliothèques et des images n'ont en général pas encore été lus depuis longtemps.
+//! Ce n'est qu'une seule mesure, affichée comme telle : elle n'a pas de distribution.
+//! Les suivants sont comptés « à chaud », les fichiers étant alors dans le cache du
+//! système, et forment une distribution (minimum, médiane, percentile 95, maximum).
+//!
+//! Pour obtenir une distribution à froid, il faut exécuter plusieurs fois le banc
+//! d'essai avec un seul lancement (`--bench-startup 1`) en vidant le cache de fichiers
+//! du système avant chaque exécution, ce que le banc d'essai ne peut pas faire lui-même
+//! de manière portable. Sous Linux, par exemple :
+//!
+//!     sync && echo 3 | sudo tee /proc/sys/vm/drop_caches
+//!
+//! Avec `--no-asset-pack`, les images sont en outre décodées depuis leurs fichiers.
+//!
+//! Le banc d'essai est lancé par l'option `--bench-startup` de la ligne de commande ou
+//! la cible `make benchstartup`. Les résultats sont écrits dans la sortie de log.
+class StartupBenchmark
+{
+public:
+    static const int DEFAULT_LAUNCH_COUNT = 10;
+
+    static int run(int launchCount = DEFAULT_LAUNCH_COUNT, const QStringList& rExtraArguments = QStringList());
+
+private:
+    StartupBenchmark() = delete;
+
+    //! Mesures d'un lancement, en millisecondes.
+    struct Launch {
+        double firstFrameMilliseconds;
+        double processMilliseconds;
+    };
+
+    static bool launch(const QStringList& rArguments, Launch& rLaunch);
+    static QString distribution(QVector<double> values);
+};
+
+#endif // STARTUPBENCHMARK_H
@@ -0,0 +1,105 @@
+/**
+  \file
+  \brief    Définition de la classe StartupTimer.
+  \date     octobre 2026
+*/
+#include "startuptimer.h"
+
+#include <QCoreApplication>
+#include <QTextStream>
+
+#include "tracerecorder.h"
+
+QElapsedTimer StartupTimer::s_timer;
+qint64 StartupTimer::s_times[StartupTimer::MILESTONE_COUNT] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+bool StartupTimer::s_isReportOnFirstFrame = false;
+
+static_assert(StartupTimer::MILESTONE_COUNT == 8, "Initialiser StartupTimer::s_times pour chaque étape");
+
+//! Noms des étapes, dans le rapport et dans la trace (chaînes constantes, voir TraceRecorder).
+static const char* const MILESTONE_NAMES[StartupTimer::MILESTONE_COUNT] = {
+    "application",      // APPLICATION_CREATED
+    "ressources",       // RESOURCES_FOUND
+    "fenetre",          // MAIN_WINDOW_CREATED
+    "prechargement",    // ASSETS_REQUESTED
+    "canvas",           // CANVAS_INITIALIZED
+    "images-menu",      // MENU_ASSETS_READY
+    "menu",             // MENU_DISPLAYED
+    "premiere-image"    // FIRST_FRAME_PAINTED
+};
+
+//! Démarre la mesure : doit être appelé au tout début de main().
+void StartupTimer::start() {
+    s_timer.start();
+    for (qint64& rTime : s_times)
+        rTime = -1;
+}
+
+//! Marque l'étape donnée, si elle ne l'a pas encore été.
+//! Lorsque la première image est dessinée et que le rapport a été demandé
+//! (setReportOnFirstFrame()), le rapport est écrit et la fin du programme est demandée.
+//! \param milestone  Étape atteinte.
+void StartupTimer::mark(Milestone milestone) {
+    if (isMarked(milestone) || !s_timer.isValid())
+        return;
+
+    s_times[milestone] = s_timer.nsecsElapsed();
+
+    if (TraceRecorder::isRecording()) {
+        qint64 previousTime = 0;
+        for (int previous = milestone - 1; previous >= 0; previous--) {
+            if (s_times[previous] >= 0) {
+                previousTime = s_times[previous];
+                break;
+            }
+        }
+        // Les événements de la trace sont datés selon l'horloge de TraceRecorder.
+        // Chacun porte le nom de l'étape qu'il termine.
+        const qint64 traceNow = TraceRecorder::now();
+        TraceRecorder::addEvent(MILESTONE_NAMES[milestone], traceNow - (s_times[milestone] - previousTime), s_times[milestone] - previousTime);
+    }
+
+    if (milestone == FIRST_FRAME_PAINTED && s_isReportOnFirstFrame) {
+        QTextStream(stdout) << report() << Qt::flush;
+        QMetaObject::invokeMethod(QCoreApplication::instance(), &QCoreApplication::quit, Qt::QueuedConnection);
+    }
+}
+
+//! \return le temps écoulé (en nanosecondes) entre start() et l'étape donnée, ou -1 si
+//! elle n'a pas été atteinte.
+qint64 StartupTimer::elapsed(Milestone milestone) {
+    return s_times[milestone];
+}
+
+//! Indique s'il faut écrire le rapport puis terminer le programme dès que la première
+//! image est dessinée (option `--startup-report`).
+void StartupTimer::setReportOnFirstFrame(bool isReportOnFirstFrame) {
+    s_isReportOnFirstFrame = isReportOnFirstFrame;
+}
+
+//! \return le nom de l'étape donnée, tel qu'il figure dans le rapport et dans la trace.
+QString StartupTimer::milestoneName(Milestone milestone) {
+    if (milestone < 0 || milestone >= MILESTONE_COUNT)
+        return QString();
+    return MILESTONE_NAMES[milestone];
+}
+
+//! \return le rapport du démarrage : une ligne par étape atteinte, avec le temps écoulé
+//! depuis le lancement et depuis l'étape précédente, en millisecondes.
+//!
+//!     Démarrage :
+//!       application          3.120 ms  (+3.120)
+//!       ...
+QString StartupTimer::report() {
+    QString text = "Démarrage :\n";
+    qint64 previousTime = 0;
+    for (int milestone = 0; milestone < MILESTONE_COUNT; milestone++) {
+        const qint64 time = s_times[milestone];
+        if (time < 0)
+            continue;
+        text += QString("  %1 %2 ms  (+%3)\n").arg(milestoneName(static_cast<Milestone>(milestone)), -16)
+                .arg(time / 1e6, 10, 'f', 3).arg((time - previousTime) / 1e6, 0, 'f', 3);
+        previousTime = time;
+    }
+    return text;
+}
@@ -0,0 +1,62 @@
+/**
+  \file
+  \brief    Déclaration de la classe StartupTimer.
+  \date     octobre 2026
+*/
+#ifndef STARTUPTIMER_H
+#define STARTUPTIMER_H
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QtGlobal>
+
+//! \brief Mesure le temps écoulé entre le lancement du programme et l'affichage de la première image.
+//!
+//! Le démarrage est découpé en étapes (Milestone), marquées dans le code par mark() :
+//! création de QApplication, recherche du répertoire des ressources, création de la
+//! fenêtre, lancement du préchargement des images, initialisation du canvas, images de
+//! l'écran de démarrage prêtes, écran de démarrage construit (polices et sprites des
+//! menus compris), puis première image de la scène dessinée.
+//!
+//! Chaque étape n'est marquée qu'une seule fois : les appels suivants à mark() ne font
+//! que comparer un entier. Si une trace est en cours d'enregistrement (TraceRecorder),
+//! chaque étape y est ajoutée, sous son nom (milestoneName()), comme un intervalle qui
+//! commence à l'étape précédente.
+//!
+//! Avec l'option `--startup-report` de la ligne de commande, le rapport (report()) est
+//! écrit sur la sortie standard dès que la première image est dessinée, puis le
+//! programme se termine : StartupBenchmark s'en sert pour mesurer des démarrages répétés.
+class StartupTimer
+{
+public:
+    enum Milestone {
+        APPLICATION_CREATED,    //!< QApplication est créée.
+        RESOURCES_FOUND,        //!< Le répertoire des ressources est trouvé.
+        MAIN_WINDOW_CREATED,    //!< La fenêtre principale (MainFrm) est créée.
+        ASSETS_REQUESTED,       //!< Le préchargement des images est lancé.
+        CANVAS_INITIALIZED,     //!< GameCanvas::onInit() commence la création de GameCore.
+        MENU_ASSETS_READY,      //!< Les images de l'écran de démarrage sont prêtes.
+        MENU_DISPLAYED,         //!< L'écran de démarrage est construit.
+        FIRST_FRAME_PAINTED,    //!< La première image de la scène est dessinée.
+        MILESTONE_COUNT
+    };
+
+    static void start();
+    static void mark(Milestone milestone);
+    static bool isMarked(Milestone milestone) { return s_times[milestone] >= 0; }
+    static qint64 elapsed(Milestone milestone);
+
+    static void setReportOnFirstFrame(bool isReportOnFirstFrame);
+
+    static QString milestoneName(Milestone milestone);
+    static QString report();
+
+private:
+    StartupTimer() = delete;
+
+    static QElapsedTimer s_timer;
+    static qint64 s_times[MILESTONE_COUNT];
+    static bool s_isReportOnFirstFrame;
+};
+
+#endif // STARTUPTIMER_H
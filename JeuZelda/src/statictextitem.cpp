@@ -0,0 +1,69 @@
+/**
+  \file
+  \brief    Définition de la classe StaticTextItem.
+  \date     octobre 2026
+*/
+#include "statictextitem.h"
+
+#include <QPainter>
+
+//! Construit un élément textuel.
+//! \param rText    Texte à afficher.
+//! \param pParent  Pointeur sur le parent (afin d'obtenir une destruction automatique de cet objet).
+StaticTextItem::StaticTextItem(const QString& rText, QGraphicsItem* pParent) : QGraphicsItem(pParent) {
+    m_brush = QBrush(Qt::black);
+    m_staticText.setTextFormat(Qt::PlainText);
+    m_staticText.setPerformanceHint(QStaticText::AggressiveCaching);
+    m_staticText.setText(rText);
+    updateLayout();
+}
+
+//! Change le texte affiché. Sa mise en page n'est recalculée que s'il est différent du texte actuel.
+//! \param rText  Texte à afficher.
+void StaticTextItem::setText(const QString& rText) {
+    if (rText == m_staticText.text())
+        return;
+
+    prepareGeometryChange();
+    m_staticText.setText(rText);
+    updateLayout();
+}
+
+//! Change la police du texte. Sa mise en page n'est recalculée que si la police est différente de l'actuelle.
+//! \param rFont  Police à utiliser.
+void StaticTextItem::setFont(const QFont& rFont) {
+    if (rFont == m_font)
+        return;
+
+    prepareGeometryChange();
+    m_font = rFont;
+    updateLayout();
+}
+
+//! Change la couleur du texte.
+//! \param rBrush  Brosse utilisée pour dessiner le texte (seule sa couleur est utilisée).
+void StaticTextItem::setBrush(const QBrush& rBrush) {
+    m_brush = rBrush;
+    update();
+}
+
+//! \return le rectangle occupé par le texte, dont le coin supérieur gauche est à l'origine.
+QRectF StaticTextItem::boundingRect() const {
+    return QRectF(QPointF(0, 0), m_staticText.size());
+}
+
+//! Dessine le texte, avec la mise en page conservée.
+void StaticTextItem::paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget) {
+    Q_UNUSED(pOption)
+    Q_UNUSED(pWidget)
+
+    pPainter->setFont(m_font);
+    pPainter->setPen(m_brush.color());
+    pPainter->drawStaticText(QPointF(0, 0), m_staticText);
+}
+
+//! Recalcule la mise en page du texte avec la police actuelle.
+void StaticTextItem::updateLayout() {
+    m_staticText.prepare(QTransform(), m_font);
+    update();
+}
@@ -0,0 +1,52 @@
+/**
+  \file
+  \brief    Déclaration de la classe StaticTextItem.
+  \date     octobre 2026
+*/
+#ifndef STATICTEXTITEM_H
+#define STATICTEXTITEM_H
+
+#include <QBrush>
+#include <QFont>
+#include <QGraphicsItem>
+#include <QStaticText>
+
+//! \brief Élément graphique qui affiche un texte dont la mise en page est calculée une seule fois.
+//!
+//! Contrairement à QGraphicsSimpleTextItem, qui refait la mise en page de son texte
+//! (choix et placement des glyphes) à chaque dessin, cet élément la conserve dans un
+//! QStaticText : elle n'est recalculée que lorsque le texte ou la police change
+//! effectivement. Les textes du jeu (numéro de vague, meilleur score, menus) changent
+//! rarement et sont dessinés à chaque image, ce qui rend ce cache avantageux.
+//!
+//! setText() et setFont() ne font rien si la valeur donnée est déjà celle de l'élément.
+//! Le texte peut contenir des retours à la ligne.
+class StaticTextItem : public QGraphicsItem
+{
+public:
+    enum { StaticTextItemType = UserType + 2 };
+
+    StaticTextItem(const QString& rText = QString(), QGraphicsItem* pParent = nullptr);
+
+    QString text() const { return m_staticText.text(); }
+    void setText(const QString& rText);
+
+    QFont font() const { return m_font; }
+    void setFont(const QFont& rFont);
+
+    QBrush brush() const { return m_brush; }
+    void setBrush(const QBrush& rBrush);
+
+    virtual QRectF boundingRect() const override;
+    virtual void paint(QPainter* pPainter, const QStyleOptionGraphicsItem* pOption, QWidget* pWidget = nullptr) override;
+    virtual int type() const override { return StaticTextItemType; }
+
+private:
+    void updateLayout();
+
+    QStaticText m_staticText;
+    QFont m_font;
+    QBrush m_brush;
+};
+
+#endif // STATICTEXTITEM_H
@@ -0,0 +1,232 @@
+/**
+  \file
+  \brief    Définition des classes SpriteFrame et TextureAtlas.
+  \date     octobre 2026
+*/
+#include "textureatlas.h"
+
+#include <algorithm>
+
+#include <QBitmap>
+#include <QDebug>
+#include <QDir>
+#include <QImage>
+#include <QPainter>
+#include <QRegion>
+
+#include "assetcache.h"
+
+QVector<QPixmap> TextureAtlas::s_pages;
+QVector<TextureAtlas::Entry> TextureAtlas::s_entries;
+QHash<QString, int> TextureAtlas::s_entryIndexes;
+
+//! \return la forme des pixels non transparents de l'image donnée, dans son propre repère.
+//! Si l'image n'a pas de transparence, sa forme est son rectangle.
+static QPainterPath opaqueShape(const QImage& rImage) {
+    QPainterPath shape;
+    if (rImage.hasAlphaChannel())
+        shape.addRegion(QRegion(QBitmap::fromImage(rImage.createAlphaMask())));
+    else
+        shape.addRect(rImage.rect());
+    return shape;
+}
+
+//! Construit une image d'animation nulle.
+SpriteFrame::SpriteFrame() {
+    m_atlasPage = -1;
+    m_atlasEntry = -1;
+}
+
+//! Construit une image d'animation qui affiche l'image indépendante donnée, en entier.
+SpriteFrame::SpriteFrame(const QPixmap& rPixmap) : SpriteFrame() {
+    m_pixmap = rPixmap;
+    m_sourceRect = rPixmap.rect();
+}
+
+//! Construit une image d'animation qui affiche une zone d'une page d'atlas.
+//! \param atlasPage    Numéro de la page (TextureAtlas::page()).
+//! \param atlasEntry   Numéro de l'image dans l'atlas (TextureAtlas::frameShape()).
+//! \param rSourceRect  Zone de la page occupée par l'image.
+SpriteFrame::SpriteFrame(int atlasPage, int atlasEntry, const QRect& rSourceRect) {
+    m_atlasPage = atlasPage;
+    m_atlasEntry = atlasEntry;
+    m_sourceRect = rSourceRect;
+}
+
+//! \return un booléen qui indique si cette image d'animation n'affiche rien.
+bool SpriteFrame::isNull() const {
+    return m_sourceRect.isEmpty() || (!isInAtlas() && m_pixmap.isNull());
+}
+
+//! \return l'image source dans laquelle se trouve la zone à afficher (sourceRect()).
+const QPixmap& SpriteFrame::sourcePixmap() const {
+    return isInAtlas() ? TextureAtlas::page(m_atlasPage) : m_pixmap;
+}
+
+//! \return la forme des pixels non transparents de cette image d'animation, dont le
+//! coin supérieur gauche est à l'origine.
+//! Pour une image de l'atlas, cette forme a été calculée lors de la construction de
+//! l'atlas ; pour une image indépendante, elle est calculée à chaque appel.
+QPainterPath SpriteFrame::shape() const {
+    if (isInAtlas())
+        return TextureAtlas::frameShape(m_atlasEntry);
+
+    QPainterPath shape;
+    const QBitmap mask = m_pixmap.mask();
+    if (mask.isNull())
+        shape.addRect(m_pixmap.rect());
+    else
+        shape.addRegion(QRegion(mask));
+    return shape;
+}
+
+//! Charge les images du répertoire donné (png, gif, jpg et bmp) et les range dans l'atlas
+//! (voir add()).
+//! \param rDirectoryPath  Chemin du répertoire des images.
+//! \return le nombre d'images ajoutées à l'atlas.
+int TextureAtlas::build(const QString& rDirectoryPath) {
+    const QDir directory(rDirectoryPath);
+    const QStringList fileNames = directory.entryList({ "*.png", "*.gif", "*.jpg", "*.jpeg", "*.bmp" },
+                                                      QDir::Files, QDir::Name);
+    QVector<SourceImage> sourceImages;
+    for (const QString& rFileName : fileNames) {
+        const QString imagePath = directory.filePath(rFileName);
+        if (contains(imagePath))
+            continue;
+
+        QImage image(imagePath);
+        if (image.isNull()) {
+            qWarning() << "Image illisible, ignorée par l'atlas :" << imagePath;
+            continue;
+        }
+        sourceImages.append(SourceImage { imagePath, image });
+    }
+    return add(sourceImages);
+}
+
+//! Range les images données dans l'atlas.
+//! Les images nulles, déjà présentes dans l'atlas ou plus grandes que MAX_FRAME_SIZE
+//! sont ignorées. Les images d'un même appel sont rangées dans de nouvelles pages.
+//! \param sourceImages  Images décodées, avec le chemin de leur fichier.
+//! \return le nombre d'images ajoutées à l'atlas.
+int TextureAtlas::add(QVector<SourceImage> sourceImages) {
+    sourceImages.erase(std::remove_if(sourceImages.begin(), sourceImages.end(), [](const SourceImage& rSource) {
+        return rSource.image.isNull() || rSource.image.width() > MAX_FRAME_SIZE
+               || rSource.image.height() > MAX_FRAME_SIZE || contains(rSource.path);
+    }), sourceImages.end());
+    if (sourceImages.isEmpty())
+        return 0;
+
+    for (SourceImage& rSource : sourceImages) {
+        if (rSource.image.format() != QImage::Format_ARGB32_Premultiplied)
+            rSource.image = rSource.image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    }
+
+    // Rangement par rangées : les images les plus hautes d'abord, afin que les
+    // rangées perdent le moins de place possible.
+    std::stable_sort(sourceImages.begin(), sourceImages.end(), [](const SourceImage& rA, const SourceImage& rB) {
+        return rA.image.height() > rB.image.height();
+    });
+
+    QImage pageImage;
+    QPainter painter;
+    int rowX = 0;
+    int rowY = 0;
+    int rowHeight = 0;
+    int usedWidth = 0;
+
+    // Termine la page en cours : elle est réduite à la surface utilisée.
+    auto finishPage = [&]() {
+        if (pageImage.isNull())
+            return;
+        painter.end();
+        s_pages.append(QPixmap::fromImage(pageImage.copy(0, 0, usedWidth, rowY + rowHeight)));
+        pageImage = QImage();
+    };
+
+    for (const SourceImage& rSource : std::as_const(sourceImages)) {
+        const int paddedWidth = rSource.image.width() + 2 * PADDING;
+        const int paddedHeight = rSource.image.height() + 2 * PADDING;
+
+        if (rowX + paddedWidth > PAGE_SIZE) {
+            rowX = 0;
+            rowY += rowHeight;
+            rowHeight = 0;
+        }
+        if (pageImage.isNull() || rowY + paddedHeight > PAGE_SIZE) {
+            finishPage();
+            pageImage = QImage(PAGE_SIZE, PAGE_SIZE, QImage::Format_ARGB32_Premultiplied);
+            pageImage.fill(Qt::transparent);
+            painter.begin(&pageImage);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            rowX = 0;
+            rowY = 0;
+            rowHeight = 0;
+            usedWidth = 0;
+        }
+
+        const QRect sourceRect(QPoint(rowX + PADDING, rowY + PADDING), rSource.image.size());
+        painter.drawImage(sourceRect.topLeft(), rSource.image);
+
+        s_entryIndexes.insert(atlasKey(rSource.path), static_cast<int>(s_entries.count()));
+        s_entries.append(Entry { static_cast<int>(s_pages.count()), sourceRect, opaqueShape(rSource.image) });
+
+        rowX += paddedWidth;
+        rowHeight = qMax(rowHeight, paddedHeight);
+        usedWidth = qMax(usedWidth, rowX);
+    }
+    finishPage();
+
+    qInfo().noquote() << QString("Atlas de textures : %1 images rangées, %2 page(s) au total")
+                         .arg(sourceImages.count()).arg(s_pages.count());
+    return static_cast<int>(sourceImages.count());
+}
+
+//! \return un booléen qui indique si l'image donnée fait partie de l'atlas.
+bool TextureAtlas::contains(const QString& rImagePath) {
+    return s_entryIndexes.contains(atlasKey(rImagePath));
+}
+
+//! \return l'image d'animation correspondant à l'image donnée : sa zone dans l'atlas
+//! si elle en fait partie, sinon l'image entière, obtenue depuis le cache AssetCache.
+SpriteFrame TextureAtlas::frame(const QString& rImagePath) {
+    auto it = s_entryIndexes.constFind(atlasKey(rImagePath));
+    if (it == s_entryIndexes.constEnd())
+        return SpriteFrame(AssetCache::pixmap(rImagePath));
+
+    const Entry& rEntry = s_entries.at(it.value());
+    return SpriteFrame(rEntry.page, it.value(), rEntry.sourceRect);
+}
+
+//! Vide l'atlas.
+//! Cette fonction doit être appelée avant la destruction de l'application,
+//! afin que les pages ne soient pas détruites après QApplication.
+void TextureAtlas::clear() {
+    s_pages.clear();
+    s_entries.clear();
+    s_entryIndexes.clear();
+}
+
+//! \return le nombre de pages de l'atlas.
+int TextureAtlas::pageCount() {
+    return static_cast<int>(s_pages.count());
+}
+
+//! \return la page d'atlas donnée.
+const QPixmap& TextureAtlas::page(int pageIndex) {
+    Q_ASSERT(pageIndex >= 0 && pageIndex < s_pages.count());
+    return s_pages.at(pageIndex);
+}
+
+//! \return la forme des pixels non transparents de l'image donnée de l'atlas,
+//! dont le coin supérieur gauche est à l'origine.
+QPainterPath TextureAtlas::frameShape(int entryIndex) {
+    Q_ASSERT(entryIndex >= 0 && entryIndex < s_entries.count());
+    return s_entries.at(entryIndex).shape;
+}
+
+//! Normalise le chemin donné afin de l'utiliser comme clé.
+//! Aucun accès au disque n'est fait.
+QString TextureAtlas::atlasKey(const QString& rImagePath) {
+    return QDir::cleanPath(QDir::fromNativeSeparators(rImagePath)).toCaseFolded();
+}
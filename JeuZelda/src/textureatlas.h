@@ -0,0 +1,108 @@
+/**
+  \file
+  \brief    Déclaration des classes SpriteFrame et TextureAtlas.
+  \date     octobre 2026
+*/
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <QHash>
+#include <QImage>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QRect>
+#include <QString>
+#include <QVector>
+
+//! \brief Image d'animation d'un sprite : une zone (sourceRect()) d'une image source.
+//!
+//! L'image source est soit une page d'atlas (TextureAtlas), partagée par de
+//! nombreuses images, soit une image indépendante. Dans le premier cas, l'image
+//! d'animation n'est qu'une référence légère (numéro de page et zone), et sa forme
+//! (shape()), utilisée pour les collisions, est calculée une seule fois par l'atlas.
+//!
+//! Une SpriteFrame se copie à faible coût.
+class SpriteFrame
+{
+public:
+    SpriteFrame();
+    explicit SpriteFrame(const QPixmap& rPixmap);
+    SpriteFrame(int atlasPage, int atlasEntry, const QRect& rSourceRect);
+
+    bool isNull() const;
+    bool isInAtlas() const { return m_atlasPage >= 0; }
+    int atlasPage() const { return m_atlasPage; }
+    QRect sourceRect() const { return m_sourceRect; }
+    QSize size() const { return m_sourceRect.size(); }
+
+    const QPixmap& sourcePixmap() const;
+    QPainterPath shape() const;
+
+private:
+    int m_atlasPage;
+    int m_atlasEntry;
+    QRect m_sourceRect;
+    QPixmap m_pixmap;
+};
+
+//! \brief Atlas de textures : regroupe de nombreuses petites images dans quelques grandes pages.
+//!
+//! add() range des images déjà décodées (par exemple par AssetPreloader) dans des pages
+//! de PAGE_SIZE x PAGE_SIZE pixels au plus, par rangées de hauteur décroissante ; build()
+//! fait de même avec toutes les images d'un répertoire.
+//! Chaque image est séparée de ses voisines par PADDING pixels transparents. Les images
+//! plus grandes que MAX_FRAME_SIZE restent indépendantes.
+//!
+//! frame() retourne ensuite l'image d'animation (SpriteFrame) d'une image de l'atlas :
+//! sa page et sa zone dans cette page. Ainsi, les sprites de types différents dessinent
+//! tous depuis la même image source, ce qui évite au moteur de dessin de changer de
+//! texture à chaque sprite, et l'image de chaque fichier n'existe qu'une fois en mémoire.
+//! Si l'image demandée n'est pas dans l'atlas, frame() retourne l'image entière,
+//! obtenue depuis le cache AssetCache.
+//!
+//! Les chemins sont normalisés comme ceux d'AssetCache, sans tenir compte de la casse :
+//! le code du jeu ne respecte pas toujours celle des fichiers (par exemple `Ennemi1_2.gif`
+//! pour `ennemi1_2.gif`), ce que Windows tolère.
+//!
+//! Comme les pages sont des QPixmap, l'atlas ne doit être utilisé que depuis le thread
+//! de l'interface graphique. clear() doit être appelé avant la destruction de QApplication.
+class TextureAtlas
+{
+public:
+    static const int PAGE_SIZE = 1024;
+    static const int MAX_FRAME_SIZE = 256;
+    static const int PADDING = 1;
+
+    //! Image décodée à ranger dans l'atlas, avec le chemin de son fichier.
+    struct SourceImage {
+        QString path;
+        QImage image;
+    };
+
+    static int add(QVector<SourceImage> sourceImages);
+    static int build(const QString& rDirectoryPath);
+    static bool contains(const QString& rImagePath);
+    static SpriteFrame frame(const QString& rImagePath);
+    static void clear();
+
+    static int pageCount();
+    static const QPixmap& page(int pageIndex);
+    static QPainterPath frameShape(int entryIndex);
+
+private:
+    TextureAtlas() = delete;
+
+    struct Entry {
+        int page;
+        QRect sourceRect;
+        QPainterPath shape;
+    };
+
+    static QString atlasKey(const QString& rImagePath);
+
+    static QVector<QPixmap> s_pages;
+    static QVector<Entry> s_entries;
+    static QHash<QString, int> s_entryIndexes;
+};
+
+#endif // TEXTUREATLAS_H
@@ -0,0 +1,87 @@
+/**
+  \file
+  \brief    Définition de la classe ThinkScheduler.
+  \date     octobre 2026
+*/
+#include "thinkscheduler.h"
+
+//! Nombre de réflexions déjà prises à partir duquel la file est compactée.
+const int DUE_COMPACTION_THRESHOLD = 4096;
+
+//! Construit un échéancier vide, dont le temps courant est nul.
+ThinkScheduler::ThinkScheduler() {
+    m_buckets.resize(BUCKET_COUNT);
+    m_nextBucket = 0;
+    m_scheduledCount = 0;
+    m_firstDueEntry = 0;
+}
+
+//! Programme la réflexion donnée. Une réflexion dont l'heure est déjà passée est rangée
+//! dans la prochaine case à vider.
+void ThinkScheduler::schedule(const Entry& rEntry) {
+    insert(rEntry);
+    m_scheduledCount++;
+}
+
+//! Vide dans la file des réflexions dues les cases dont l'heure est atteinte.
+//! \param time  Temps de jeu courant, en millisecondes.
+void ThinkScheduler::advance(qint64 time) {
+    const qint64 lastBucket = time / BUCKET_DURATION;
+    // Sans réflexion programmée, les cases sont vides : le temps peut avancer d'un coup.
+    if (m_scheduledCount == 0 && m_nextBucket <= lastBucket)
+        m_nextBucket = lastBucket + 1;
+
+    // La case vidée reçoit en échange la liste (vide) de la case précédente, dont la
+    // capacité est ainsi conservée.
+    QVector<Entry> bucketEntries;
+    while (m_nextBucket <= lastBucket) {
+        bucketEntries.swap(m_buckets[static_cast<int>(m_nextBucket % BUCKET_COUNT)]);
+        m_nextBucket++;
+        for (const Entry& rEntry : std::as_const(bucketEntries)) {
+            // Réflexion plus lointaine que la roue lors de son inscription.
+            if (rEntry.thinkTime > time) {
+                insert(rEntry);
+                continue;
+            }
+            m_dueEntries.append(rEntry);
+            m_scheduledCount--;
+        }
+        bucketEntries.clear();
+    }
+}
+
+//! Retire la plus ancienne réflexion due.
+//! \param rEntry  Reçoit la réflexion retirée.
+//! \return un booléen à faux s'il n'y a plus de réflexion due.
+bool ThinkScheduler::takeDue(Entry& rEntry) {
+    if (m_firstDueEntry >= m_dueEntries.count()) {
+        m_dueEntries.clear();
+        m_firstDueEntry = 0;
+        return false;
+    }
+
+    rEntry = m_dueEntries.at(m_firstDueEntry++);
+    if (m_firstDueEntry >= DUE_COMPACTION_THRESHOLD && m_firstDueEntry * 2 >= m_dueEntries.count()) {
+        m_dueEntries.remove(0, m_firstDueEntry);
+        m_firstDueEntry = 0;
+    }
+    return true;
+}
+
+//! Annule toutes les réflexions et remet le temps courant à zéro.
+void ThinkScheduler::clear() {
+    for (QVector<Entry>& rBucket : m_buckets)
+        rBucket.clear();
+    m_nextBucket = 0;
+    m_scheduledCount = 0;
+    m_dueEntries.clear();
+    m_firstDueEntry = 0;
+}
+
+//! Range la réflexion donnée dans la première case qui commence à son heure ou après
+//! elle, sans dépasser la dernière case de la roue.
+void ThinkScheduler::insert(const Entry& rEntry) {
+    const qint64 thinkBucket = (qMax<qint64>(0, rEntry.thinkTime) + BUCKET_DURATION - 1) / BUCKET_DURATION;
+    const qint64 bucket = qBound(m_nextBucket, thinkBucket, m_nextBucket + BUCKET_COUNT - 1);
+    m_buckets[static_cast<int>(bucket % BUCKET_COUNT)].append(rEntry);
+}
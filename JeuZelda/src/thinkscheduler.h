@@ -0,0 +1,65 @@
+/**
+  \file
+  \brief    Déclaration de la classe ThinkScheduler.
+  \date     octobre 2026
+*/
+#ifndef THINKSCHEDULER_H
+#define THINKSCHEDULER_H
+
+#include <QVector>
+#include <QtGlobal>
+
+//! \brief Échéancier des réflexions des ennemis : une roue de cases, suivie d'une file
+//! des réflexions arrivées à échéance.
+//!
+//! Chaque ennemi d'EnemyStore y est inscrit une seule fois, avec l'heure de sa prochaine
+//! réflexion (Entry). La roue compte BUCKET_COUNT cases de BUCKET_DURATION millisecondes
+//! de temps de jeu ; une réflexion est rangée dans la première case qui commence à son
+//! heure ou après elle, si bien qu'elle n'est jamais avancée. Une réflexion plus lointaine
+//! que la roue n'est rangée dans sa case qu'au tour suivant.
+//!
+//! advance() vide dans la file des réflexions dues toutes les cases dont l'heure est
+//! atteinte, dans l'ordre des cases puis dans l'ordre d'inscription : ce travail ne dépend
+//! que du nombre de réflexions dues, et non du nombre d'ennemis. takeDue() les retire
+//! ensuite une à une : celles qui n'ont pas été prises restent dans la file, en tête,
+//! jusqu'au tick suivant.
+//!
+//! L'échéancier ne connaît que des identifiants : EnemyStore écarte les réflexions des
+//! ennemis retirés entretemps grâce à leur génération.
+class ThinkScheduler
+{
+public:
+    //! Réflexion programmée d'un ennemi.
+    struct Entry {
+        quint32 enemyId;
+        quint32 generation;
+        qint64 thinkTime;
+    };
+
+    //! Durée (en millisecondes de temps de jeu) d'une case de la roue.
+    static const int BUCKET_DURATION = 16;
+    //! Nombre de cases de la roue (un peu plus de 16 secondes).
+    static const int BUCKET_COUNT = 1024;
+
+    ThinkScheduler();
+
+    void schedule(const Entry& rEntry);
+    void advance(qint64 time);
+    bool takeDue(Entry& rEntry);
+    void clear();
+
+    int scheduledCount() const { return m_scheduledCount; }
+    int dueCount() const { return static_cast<int>(m_dueEntries.count()) - m_firstDueEntry; }
+
+private:
+    void insert(const Entry& rEntry);
+
+    QVector<QVector<Entry>> m_buckets;
+    qint64 m_nextBucket;        // Numéro (depuis le temps zéro) de la prochaine case à vider.
+    int m_scheduledCount;       // Réflexions rangées dans la roue.
+
+    QVector<Entry> m_dueEntries;
+    int m_firstDueEntry;
+};
+
+#endif // THINKSCHEDULER_H
@@ -0,0 +1,160 @@
+/**
+  \file
+  \brief    Définition de la classe TickProfiler.
+  \date     octobre 2026
+*/
+#include "tickprofiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QElapsedTimer>
+#include <QStringList>
+
+static_assert((TickProfiler::SAMPLE_COUNT & (TickProfiler::SAMPLE_COUNT - 1)) == 0,
+              "SAMPLE_COUNT doit être une puissance de deux");
+
+//! Noms des phases, dans l'ordre de TickProfiler::Phase.
+static const char* const PHASE_NAMES[TickProfiler::PHASE_COUNT] = {
+    "Tick", "Input", "Player", "Enemies", "Bullets", "Waves", "Collisions", "Pickups", "Scene", "Animation", "Paint"
+};
+
+std::atomic<bool> TickProfiler::s_enabled(false);
+TickProfiler::PhaseSamples TickProfiler::s_phases[TickProfiler::PHASE_COUNT];
+
+//! \return l'horloge monotone commune à toutes les mesures.
+static const QElapsedTimer& profilerClock() {
+    static const QElapsedTimer clock = []() {
+        QElapsedTimer timer;
+        timer.start();
+        return timer;
+    }();
+    return clock;
+}
+
+//! Calcule le percentile donné d'échantillons triés (méthode du rang le plus proche).
+static qint64 percentile(const qint64* pSortedSamples, int sampleCount, double rank) {
+    const int index = static_cast<int>(std::ceil(rank * sampleCount)) - 1;
+    return pSortedSamples[qBound(0, index, sampleCount - 1)];
+}
+
+//! Active ou désactive les mesures.
+//! Les échantillons sont effacés à l'activation, afin de ne pas mélanger deux périodes.
+void TickProfiler::setEnabled(bool enabled) {
+    if (enabled && !isEnabled())
+        reset();
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//! \return le temps courant, en nanosecondes, de l'horloge des mesures.
+qint64 TickProfiler::now() {
+    return profilerClock().nsecsElapsed();
+}
+
+//! Ajoute la durée donnée au cumul du tick en cours pour la phase donnée.
+void TickProfiler::addTime(Phase phase, qint64 durationInNanoseconds) {
+    Q_ASSERT(phase >= 0 && phase < PHASE_COUNT);
+    s_phases[phase].pendingTime.fetch_add(durationInNanoseconds, std::memory_order_relaxed);
+}
+
+//! Termine une zone de mesure (ProfileZone) commencée au temps donné : sa durée est
+//! ajoutée au cumul de sa phase et, si une trace est enregistrée, à la trace.
+void TickProfiler::endZone(Phase phase, qint64 startTime) {
+    const qint64 duration = now() - startTime;
+    if (isEnabled())
+        addTime(phase, duration);
+    if (TraceRecorder::isRecording())
+        TraceRecorder::addEvent(PHASE_NAMES[phase], startTime, duration);
+}
+
+//! Termine le tick en cours : le cumul de chaque phase du tick devient un échantillon.
+//! Le dessin (PAINT), qui n'a pas lieu à chaque tick, est échantillonné par commitFrame().
+void TickProfiler::commitTick() {
+    if (!isEnabled())
+        return;
+
+    for (int phaseIndex = 0; phaseIndex < PHASE_COUNT; phaseIndex++) {
+        if (phaseIndex != PAINT)
+            commitSample(s_phases[phaseIndex]);
+    }
+}
+
+//! Termine l'image en cours : le cumul du dessin (PAINT) devient un échantillon.
+//! Appelé par GameView à la fin de chaque dessin de la vue.
+void TickProfiler::commitFrame() {
+    if (!isEnabled())
+        return;
+
+    commitSample(s_phases[PAINT]);
+}
+
+//! Range le cumul en cours de la phase donnée dans son tampon circulaire.
+void TickProfiler::commitSample(PhaseSamples& rPhase) {
+    const quint32 index = rPhase.writeIndex.load(std::memory_order_relaxed);
+    rPhase.samples[index & (SAMPLE_COUNT - 1)].store(rPhase.pendingTime.exchange(0, std::memory_order_relaxed),
+                                                     std::memory_order_relaxed);
+    rPhase.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+//! Efface tous les échantillons et les cumuls en cours.
+void TickProfiler::reset() {
+    for (PhaseSamples& rPhase : s_phases) {
+        rPhase.pendingTime.store(0, std::memory_order_relaxed);
+        rPhase.writeIndex.store(0, std::memory_order_relaxed);
+    }
+}
+
+//! \return les percentiles et le maximum des échantillons de la phase donnée.
+//! Si la phase n'a encore aucun échantillon, toutes les durées sont nulles.
+TickProfiler::PhaseStatistics TickProfiler::statistics(Phase phase) {
+    Q_ASSERT(phase >= 0 && phase < PHASE_COUNT);
+    const PhaseSamples& rPhase = s_phases[phase];
+
+    const quint32 writeIndex = rPhase.writeIndex.load(std::memory_order_acquire);
+    const int sampleCount = static_cast<int>(qMin<quint32>(writeIndex, SAMPLE_COUNT));
+    if (sampleCount == 0)
+        return PhaseStatistics { 0, 0, 0, 0, 0 };
+
+    qint64 sortedSamples[SAMPLE_COUNT];
+    for (int sampleIndex = 0; sampleIndex < sampleCount; sampleIndex++)
+        sortedSamples[sampleIndex] = rPhase.samples[sampleIndex].load(std::memory_order_relaxed);
+    std::sort(sortedSamples, sortedSamples + sampleCount);
+
+    return PhaseStatistics { percentile(sortedSamples, sampleCount, 0.50),
+                             percentile(sortedSamples, sampleCount, 0.95),
+                             percentile(sortedSamples, sampleCount, 0.99),
+                             sortedSamples[sampleCount - 1],
+                             sampleCount };
+}
+
+//! \return le nom de la phase donnée, tel qu'il est affiché par report() et dans les traces.
+QString TickProfiler::phaseName(Phase phase) {
+    Q_ASSERT(phase >= 0 && phase < PHASE_COUNT);
+    return PHASE_NAMES[phase];
+}
+
+//! \return un tableau des percentiles de toutes les phases (en microsecondes),
+//! une ligne par phase, précédé d'une ligne d'en-tête. Les échantillons du dessin sont
+//! des images, et non des ticks : leur nombre est indiqué sur sa ligne.
+QString TickProfiler::report() {
+    QStringList lines;
+    lines << QString("%1 %2 %3 %4 %5 (µs, %6 ticks)")
+             .arg(QString("Phase"), -10).arg(QString("p50"), 7).arg(QString("p95"), 7)
+             .arg(QString("p99"), 7).arg(QString("max"), 7)
+             .arg(statistics(TICK).sampleCount);
+
+    for (int phaseIndex = 0; phaseIndex < PHASE_COUNT; phaseIndex++) {
+        const Phase phase = static_cast<Phase>(phaseIndex);
+        const PhaseStatistics stats = statistics(phase);
+        QString line = QString("%1 %2 %3 %4 %5")
+                       .arg(phaseName(phase), -10)
+                       .arg(stats.p50 / 1000, 7)
+                       .arg(stats.p95 / 1000, 7)
+                       .arg(stats.p99 / 1000, 7)
+                       .arg(stats.max / 1000, 7);
+        if (phase == PAINT)
+            line += QString(" (%1 images)").arg(stats.sampleCount);
+        lines << line;
+    }
+    return lines.join('\n');
+}
@@ -0,0 +1,131 @@
+/**
+  \file
+  \brief    Déclaration des classes TickProfiler et ProfileZone.
+  \date     octobre 2026
+*/
+#ifndef TICKPROFILER_H
+#define TICKPROFILER_H
+
+#include <atomic>
+
+#include <QString>
+#include <QtGlobal>
+
+#include "tracerecorder.h"
+
+//! \brief Mesure la durée de chaque phase du tick et en calcule les percentiles.
+//!
+//! Les phases (Phase) sont délimitées dans le code par des zones de mesure (ProfileZone).
+//! Le temps passé dans chaque zone est cumulé par phase, puis commitTick(), appelé par
+//! GameCanvas à la fin de chaque tick, range ces cumuls dans un tampon circulaire propre
+//! à chaque phase, qui conserve les SAMPLE_COUNT derniers ticks. Une phase parcourue
+//! plusieurs fois durant un tick donne ainsi un seul
+//! échantillon, et une phase absente de ce tick un échantillon nul.
+//!
+//! Le dessin de la vue (PAINT) a lieu une fois par image, après zéro, un ou plusieurs
+//! ticks : son cumul est rangé par commitFrame(), appelé par GameView à la fin de chaque
+//! dessin, et ses échantillons sont ceux des dernières images.
+//!
+//! statistics() calcule les percentiles 50, 95 et 99 ainsi que le maximum de ces
+//! échantillons ; report() les met en forme, une ligne par phase. GameCanvas les
+//! affiche avec les informations détaillées (touches Ctrl+Shift+I).
+//!
+//! Le profileur est disponible dans toutes les configurations, mais il est désactivé
+//! par défaut (setEnabled()) : une zone de mesure se réduit alors à la lecture de deux
+//! booléens. GameCanvas l'active lorsque les informations détaillées sont visibles.
+//!
+//! Si une trace est en cours d'enregistrement (TraceRecorder), chaque zone de mesure
+//! y est également ajoutée, sous le nom de sa phase.
+//!
+//! Les cumuls et les tampons n'utilisent que des opérations atomiques, sans verrou :
+//! une zone peut être mesurée depuis un autre thread que celui du jeu.
+class TickProfiler
+{
+public:
+    enum Phase {
+        TICK,           //!< Tick complet (GameCore et GameScene).
+        INPUT,          //!< Transmission des touches à GameCore.
+        PLAYER,         //!< Tick du joueur.
+        ENEMIES,        //!< Tick des ennemis.
+        BULLETS,        //!< Déplacement et collisions des projectiles du moteur de projectiles.
+        WAVES,          //!< Génération des vagues d'ennemis.
+        COLLISIONS,     //!< Détection des collisions du joueur.
+        PICKUPS,        //!< Réaction aux collisions du joueur (dégâts, objets ramassés).
+        SCENE,          //!< Tick des sprites de la scène.
+        ANIMATION,      //!< Avancement des animations.
+        PAINT,          //!< Dessin de la vue, échantillonné par image (commitFrame()).
+        PHASE_COUNT
+    };
+
+    //! Nombre d'échantillons conservés par phase (une puissance de deux).
+    static const int SAMPLE_COUNT = 256;
+
+    //! Durées (en nanosecondes) calculées sur les échantillons d'une phase.
+    struct PhaseStatistics {
+        qint64 p50;
+        qint64 p95;
+        qint64 p99;
+        qint64 max;
+        int sampleCount;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    static qint64 now();
+    static void addTime(Phase phase, qint64 durationInNanoseconds);
+    static void endZone(Phase phase, qint64 startTime);
+    static void commitTick();
+    static void commitFrame();
+    static void reset();
+
+    static PhaseStatistics statistics(Phase phase);
+    static QString phaseName(Phase phase);
+    static QString report();
+
+private:
+    TickProfiler() = delete;
+
+    struct PhaseSamples {
+        std::atomic<qint64> pendingTime;
+        std::atomic<quint32> writeIndex;
+        std::atomic<qint64> samples[SAMPLE_COUNT];
+    };
+
+    static void commitSample(PhaseSamples& rPhase);
+
+    static std::atomic<bool> s_enabled;
+    static PhaseSamples s_phases[PHASE_COUNT];
+};
+
+//! \brief Zone de mesure : le temps écoulé entre sa construction et sa destruction
+//! est attribué à la phase donnée (voir TickProfiler).
+//!
+//!     {
+//!         ProfileZone zone(TickProfiler::ENEMIES);
+//!         ...
+//!     }
+//!
+//! Si le profileur est désactivé et qu'aucune trace n'est enregistrée à la construction
+//! de la zone, rien n'est mesuré.
+class ProfileZone
+{
+public:
+    explicit ProfileZone(TickProfiler::Phase phase)
+        : m_phase(phase),
+          m_startTime(TickProfiler::isEnabled() || TraceRecorder::isRecording() ? TickProfiler::now() : -1) {}
+
+    ~ProfileZone() {
+        if (m_startTime >= 0)
+            TickProfiler::endZone(m_phase, m_startTime);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    TickProfiler::Phase m_phase;
+    qint64 m_startTime;
+};
+
+#endif // TICKPROFILER_H
@@ -0,0 +1,254 @@
+/**
+  \file
+  \brief    Définition de la classe TimerWheel.
+  \date     octobre 2026
+*/
+#include "timerwheel.h"
+
+#include <cmath>
+
+//! Délai le plus long que la roue peut représenter, en millisecondes. Un minuteur plus
+//! lointain est rangé à cette distance, puis redistribué jusqu'à son échéance.
+const long long MAX_SLOT_DELAY = (1LL << (TimerWheel::SLOT_BITS * TimerWheel::LEVEL_COUNT)) - 1;
+
+//! Construit une roue de minuteurs vide, dont le temps courant est nul.
+TimerWheel::TimerWheel() {
+    m_firstFreeNode = NO_NODE;
+    m_pendingCount = 0;
+    m_currentTime = 0;
+    m_timeScale = 1.0;
+    m_pendingTime = 0.0;
+    for (int& rSlot : m_slots)
+        rSlot = NO_NODE;
+}
+
+//! Programme un minuteur.
+//! \param delayInMilliseconds  Délai, en millisecondes de jeu, avant l'appel de la fonction.
+//!                             Un délai nul ou négatif est arrondi à une milliseconde : la
+//!                             fonction est appelée au prochain avancement de la roue.
+//! \param rCallback            Fonction à appeler à l'échéance.
+//! \param pOwner               Sprite propriétaire du minuteur (facultatif) : le minuteur est
+//!                             annulé lorsque ce sprite est retiré de la scène ou détruit.
+//! \return l'identifiant du minuteur, qui permet de l'annuler.
+TimerWheel::TimerId TimerWheel::schedule(long long delayInMilliseconds, const Callback& rCallback, const Sprite* pOwner) {
+    const int newNode = allocateNode();
+    Node& rNode = m_nodes[newNode];
+    rNode.expiration = m_currentTime + qMax(1LL, delayInMilliseconds);
+    rNode.callback = rCallback;
+    rNode.pOwner = pOwner;
+
+    insertNode(newNode);
+    linkToOwner(newNode);
+    m_pendingCount++;
+    return (static_cast<TimerId>(rNode.generation) << 32) | static_cast<TimerId>(newNode);
+}
+
+//! Annule le minuteur donné.
+//! \return un booléen à faux si le minuteur n'est plus programmé (déjà déclenché ou annulé).
+bool TimerWheel::cancel(TimerId timerId) {
+    const int cancelledNode = nodeIndex(timerId);
+    if (cancelledNode == NO_NODE)
+        return false;
+
+    unlinkNode(cancelledNode);
+    unlinkFromOwner(cancelledNode);
+    releaseNode(cancelledNode);
+    m_pendingCount--;
+    return true;
+}
+
+//! Annule tous les minuteurs du sprite donné.
+//! Appelé par la scène lorsque ce sprite est retiré de la scène ou détruit.
+void TimerWheel::cancelAll(const Sprite* pOwner) {
+    auto it = m_firstNodeOfOwner.find(pOwner);
+    if (it == m_firstNodeOfOwner.end())
+        return;
+
+    int cancelledNode = it.value();
+    m_firstNodeOfOwner.erase(it);
+    while (cancelledNode != NO_NODE) {
+        const int nextNode = m_nodes.at(cancelledNode).nextOfOwner;
+        unlinkNode(cancelledNode);
+        releaseNode(cancelledNode);
+        m_pendingCount--;
+        cancelledNode = nextNode;
+    }
+}
+
+//! Annule tous les minuteurs.
+void TimerWheel::clear() {
+    m_nodes.clear();
+    m_firstFreeNode = NO_NODE;
+    m_firstNodeOfOwner.clear();
+    m_pendingCount = 0;
+    for (int& rSlot : m_slots)
+        rSlot = NO_NODE;
+}
+
+//! \return un booléen qui indique si le minuteur donné est encore programmé.
+bool TimerWheel::isScheduled(TimerId timerId) const {
+    return nodeIndex(timerId) != NO_NODE;
+}
+
+//! Modifie l'écoulement du temps des minuteurs.
+//! \param timeScale  Facteur appliqué au temps écoulé (1 : normal, 2 : deux fois plus
+//!                   rapide, 0 : minuteurs suspendus).
+void TimerWheel::setTimeScale(double timeScale) {
+    m_timeScale = qMax(0.0, timeScale);
+}
+
+//! Fait avancer le temps de la roue et appelle les fonctions des minuteurs arrivés à
+//! échéance, dans l'ordre de leurs échéances.
+//! Une fonction appelée peut programmer ou annuler d'autres minuteurs.
+//! \param elapsedTimeInMilliseconds  Temps écoulé depuis l'avancement précédent.
+void TimerWheel::advance(long long elapsedTimeInMilliseconds) {
+    m_pendingTime += elapsedTimeInMilliseconds * m_timeScale;
+    long long stepCount = static_cast<long long>(std::floor(m_pendingTime));
+    m_pendingTime -= static_cast<double>(stepCount);
+
+    while (stepCount > 0 && m_pendingCount > 0) {
+        step();
+        stepCount--;
+    }
+    // Sans minuteur, les cases sont vides : le temps peut avancer d'un coup.
+    m_currentTime += stepCount;
+}
+
+//! \return un nœud libre, pris dans la liste des nœuds libres ou ajouté au tableau.
+int TimerWheel::allocateNode() {
+    if (m_firstFreeNode != NO_NODE) {
+        const int freeNode = m_firstFreeNode;
+        m_firstFreeNode = m_nodes.at(freeNode).next;
+        return freeNode;
+    }
+
+    Node node;
+    node.expiration = 0;
+    node.pOwner = nullptr;
+    node.generation = 1;
+    node.slot = -1;
+    node.previous = node.next = NO_NODE;
+    node.previousOfOwner = node.nextOfOwner = NO_NODE;
+    m_nodes.append(node);
+    return static_cast<int>(m_nodes.count()) - 1;
+}
+
+//! Rend le nœud donné à la liste des nœuds libres. Son identifiant ne désigne plus rien.
+void TimerWheel::releaseNode(int nodeIndex) {
+    Node& rNode = m_nodes[nodeIndex];
+    rNode.callback = nullptr;
+    rNode.pOwner = nullptr;
+    rNode.slot = -1;
+    rNode.generation = (rNode.generation == 0xFFFFFFFFu) ? 1 : rNode.generation + 1;
+    rNode.next = m_firstFreeNode;
+    m_firstFreeNode = nodeIndex;
+}
+
+//! Range le nœud donné dans la case de son échéance, au niveau le plus fin possible.
+void TimerWheel::insertNode(int nodeIndex) {
+    Node& rNode = m_nodes[nodeIndex];
+    const long long delay = qBound(0LL, rNode.expiration - m_currentTime, MAX_SLOT_DELAY);
+    const long long slotTime = m_currentTime + delay;
+
+    int level = 0;
+    while (level < LEVEL_COUNT - 1 && delay >= (1LL << (SLOT_BITS * (level + 1))))
+        level++;
+    const int slot = level * SLOT_COUNT + static_cast<int>((slotTime >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+
+    rNode.slot = slot;
+    rNode.previous = NO_NODE;
+    rNode.next = m_slots[slot];
+    if (rNode.next != NO_NODE)
+        m_nodes[rNode.next].previous = nodeIndex;
+    m_slots[slot] = nodeIndex;
+}
+
+//! Retire le nœud donné de sa case.
+void TimerWheel::unlinkNode(int nodeIndex) {
+    const Node& rNode = m_nodes.at(nodeIndex);
+    if (rNode.previous != NO_NODE)
+        m_nodes[rNode.previous].next = rNode.next;
+    else
+        m_slots[rNode.slot] = rNode.next;
+    if (rNode.next != NO_NODE)
+        m_nodes[rNode.next].previous = rNode.previous;
+}
+
+//! Chaîne le nœud donné avec les autres minuteurs de son propriétaire, s'il en a un.
+void TimerWheel::linkToOwner(int nodeIndex) {
+    Node& rNode = m_nodes[nodeIndex];
+    rNode.previousOfOwner = NO_NODE;
+    rNode.nextOfOwner = m_firstNodeOfOwner.value(rNode.pOwner, NO_NODE);
+    if (rNode.pOwner == nullptr)
+        return;
+
+    if (rNode.nextOfOwner != NO_NODE)
+        m_nodes[rNode.nextOfOwner].previousOfOwner = nodeIndex;
+    m_firstNodeOfOwner.insert(rNode.pOwner, nodeIndex);
+}
+
+//! Retire le nœud donné de la liste des minuteurs de son propriétaire, s'il en a un.
+void TimerWheel::unlinkFromOwner(int nodeIndex) {
+    const Node& rNode = m_nodes.at(nodeIndex);
+    if (rNode.pOwner == nullptr)
+        return;
+
+    if (rNode.previousOfOwner != NO_NODE)
+        m_nodes[rNode.previousOfOwner].nextOfOwner = rNode.nextOfOwner;
+    else if (rNode.nextOfOwner != NO_NODE)
+        m_firstNodeOfOwner.insert(rNode.pOwner, rNode.nextOfOwner);
+    else
+        m_firstNodeOfOwner.remove(rNode.pOwner);
+    if (rNode.nextOfOwner != NO_NODE)
+        m_nodes[rNode.nextOfOwner].previousOfOwner = rNode.previousOfOwner;
+}
+
+//! \return le nœud du minuteur donné, ou NO_NODE s'il n'est plus programmé.
+int TimerWheel::nodeIndex(TimerId timerId) const {
+    const qint64 index = static_cast<qint64>(timerId & 0xFFFFFFFFu);
+    const quint32 generation = static_cast<quint32>(timerId >> 32);
+    if (index >= m_nodes.count())
+        return NO_NODE;
+
+    const Node& rNode = m_nodes.at(index);
+    return (rNode.slot >= 0 && rNode.generation == generation) ? static_cast<int>(index) : NO_NODE;
+}
+
+//! Fait avancer le temps d'une milliseconde : redistribue au besoin les cases des
+//! niveaux supérieurs, puis déclenche les minuteurs de la case courante du premier niveau.
+void TimerWheel::step() {
+    m_currentTime++;
+
+    // Niveaux dont la case courante vient de changer, du plus haut au plus bas : chacun
+    // redistribue ses minuteurs dans les niveaux inférieurs.
+    int topLevel = 0;
+    while (topLevel < LEVEL_COUNT - 1 && (m_currentTime & ((1LL << (SLOT_BITS * (topLevel + 1))) - 1)) == 0)
+        topLevel++;
+    for (int level = topLevel; level > 0; level--)
+        cascade(level);
+
+    const int slot = static_cast<int>(m_currentTime & (SLOT_COUNT - 1));
+    while (m_slots[slot] != NO_NODE) {
+        const int expiredNode = m_slots[slot];
+        unlinkNode(expiredNode);
+        unlinkFromOwner(expiredNode);
+        // La fonction est retirée du nœud avant son appel : elle peut programmer de
+        // nouveaux minuteurs, ce qui peut agrandir le tableau des nœuds.
+        const Callback callback = std::move(m_nodes[expiredNode].callback);
+        releaseNode(expiredNode);
+        m_pendingCount--;
+        callback();
+    }
+}
+
+//! Redistribue les minuteurs de la case courante du niveau donné dans les niveaux inférieurs.
+void TimerWheel::cascade(int level) {
+    const int slot = level * SLOT_COUNT + static_cast<int>((m_currentTime >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+    int cascadedNode = m_slots[slot];
+    m_slots[slot] = NO_NODE;
+    while (cascadedNode != NO_NODE) {
+        const int nextNode = m_nodes.at(cascadedNode).next;
+        insertNode(cascadedNode);
+        cascadedNode = nextNode;
+    }
+}
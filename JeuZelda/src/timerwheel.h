@@ -0,0 +1,105 @@
+/**
+  \file
+  \brief    Déclaration de la classe TimerWheel.
+  \date     octobre 2026
+*/
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <functional>
+
+#include <QHash>
+#include <QVector>
+#include <QtGlobal>
+
+class Sprite;
+
+//! \brief Roue de minuteurs hiérarchique, cadencée par le tick du jeu.
+//!
+//! Chaque scène (GameScene) possède sa propre roue de minuteurs (timerWheel()), qu'elle
+//! fait avancer lors de chaque tick (GameScene::tick()) avec le temps écoulé depuis le
+//! tick précédent. Les minuteurs remplacent QTimer::singleShot() pour les effets de jeu
+//! (retour à la couleur normale d'un ennemi touché, fin de l'effet d'un objet, ...) :
+//! - comme pour l'horloge d'animation, leur temps est celui du jeu : il ne s'écoule pas
+//!   lorsque la cadence est stoppée, et il peut être accéléré, ralenti ou suspendu avec
+//!   setTimeScale() ;
+//! - un minuteur peut appartenir à un sprite : il est alors annulé lorsque ce sprite est
+//!   retiré de la scène ou détruit, ce qui évite d'appeler une fonction sur un sprite
+//!   disparu ;
+//! - la programmation et l'annulation d'un minuteur se font en temps constant, sans
+//!   passer par la boucle d'événements de Qt.
+//!
+//! La roue compte LEVEL_COUNT niveaux de SLOT_COUNT cases. Une case du premier niveau
+//! correspond à une milliseconde, une case du niveau suivant à SLOT_COUNT cases du
+//! niveau précédent, et ainsi de suite. Un minuteur est rangé dans la case qui contient
+//! son échéance, au niveau le plus fin possible ; lorsque le premier niveau a fait un
+//! tour, la case courante du niveau suivant est redistribuée dans les niveaux inférieurs.
+//! Les minuteurs sont conservés dans un tableau de nœuds réutilisés, chaînés entre eux
+//! dans leur case et, s'ils en ont un, avec les autres minuteurs de leur propriétaire.
+//!
+//! Un minuteur est désigné par un identifiant (TimerId), qui ne désigne plus rien une
+//! fois le minuteur déclenché ou annulé : l'annuler ensuite est sans effet.
+class TimerWheel
+{
+public:
+    typedef quint64 TimerId;
+    typedef std::function<void()> Callback;
+
+    static const TimerId INVALID_TIMER = 0;
+    static const int SLOT_BITS = 6;
+    static const int SLOT_COUNT = 1 << SLOT_BITS;
+    static const int LEVEL_COUNT = 4;
+
+    TimerWheel();
+
+    TimerId schedule(long long delayInMilliseconds, const Callback& rCallback, const Sprite* pOwner = nullptr);
+    bool cancel(TimerId timerId);
+    void cancelAll(const Sprite* pOwner);
+    void clear();
+
+    bool isScheduled(TimerId timerId) const;
+    int pendingCount() const { return m_pendingCount; }
+    long long currentTime() const { return m_currentTime; }
+
+    void setTimeScale(double timeScale);
+    double timeScale() const { return m_timeScale; }
+
+    void advance(long long elapsedTimeInMilliseconds);
+
+private:
+    //! Minuteur, chaîné dans sa case et avec les minuteurs de son propriétaire.
+    struct Node {
+        long long expiration;
+        Callback callback;
+        const Sprite* pOwner;
+        quint32 generation;
+        int slot;           //!< Case (niveau * SLOT_COUNT + numéro), ou -1 si le nœud est libre.
+        int previous;
+        int next;           //!< Nœud suivant de la case, ou de la liste des nœuds libres.
+        int previousOfOwner;
+        int nextOfOwner;
+    };
+
+    static const int NO_NODE = -1;
+
+    int allocateNode();
+    void releaseNode(int nodeIndex);
+    void insertNode(int nodeIndex);
+    void unlinkNode(int nodeIndex);
+    void linkToOwner(int nodeIndex);
+    void unlinkFromOwner(int nodeIndex);
+    int nodeIndex(TimerId timerId) const;
+    void step();
+    void cascade(int level);
+
+    QVector<Node> m_nodes;
+    int m_firstFreeNode;
+    int m_slots[LEVEL_COUNT * SLOT_COUNT];
+    QHash<const Sprite*, int> m_firstNodeOfOwner;
+    int m_pendingCount;
+    long long m_currentTime;
+    double m_timeScale;
+    double m_pendingTime;
+};
+
+#endif // TIMERWHEEL_H
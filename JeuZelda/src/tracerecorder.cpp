@@ -0,0 +1,216 @@
+/**
+  \file
+  \brief    Définition de la classe TraceRecorder.
+  \date     octobre 2026
+*/
+#include "tracerecorder.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include <QDebug>
+#include <QFile>
+#include <QList>
+#include <QVector>
+
+#include "tickprofiler.h"
+
+//! Nombre d'événements accumulés en mémoire avant d'être transmis au thread d'écriture.
+const int BUFFER_EVENT_COUNT = 8192;
+
+//! Identifiant de processus inscrit dans chaque événement.
+const int TRACE_PROCESS_ID = 1;
+
+namespace {
+
+//! Un intervalle mesuré, tel qu'il est conservé jusqu'à son écriture.
+struct TraceEvent {
+    const char* pName;
+    qint64 startTime;
+    qint64 duration;
+    int threadId;
+};
+
+typedef QVector<TraceEvent> TraceEventBuffer;
+
+std::atomic<int> s_nextThreadId(1);
+
+// Tampon des événements en cours d'accumulation.
+std::mutex s_bufferMutex;
+TraceEventBuffer s_buffer;
+qint64 s_eventCount = 0;
+
+// Tampons pleins, en attente d'écriture, et thread d'écriture.
+std::mutex s_queueMutex;
+std::condition_variable s_queueCondition;
+QList<TraceEventBuffer> s_pendingBuffers;
+bool s_stopRequested = false;
+std::thread s_writerThread;
+
+// Fichier de trace : utilisé uniquement par le thread d'écriture entre start() et stop().
+QFile s_file;
+bool s_isFirstEvent = true;
+
+//! \return le numéro du thread courant dans la trace (1 pour le premier thread qui
+//! enregistre un événement, c'est-à-dire le thread du jeu).
+int currentThreadId() {
+    thread_local const int threadId = s_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+//! \return la chaîne donnée, échappée pour être placée entre guillemets dans du JSON.
+QByteArray jsonEscaped(const char* pText) {
+    QByteArray escapedText;
+    for (const char* pChar = pText; *pChar != '\0'; pChar++) {
+        if (*pChar == '"' || *pChar == '\\')
+            escapedText.append('\\');
+        escapedText.append(*pChar);
+    }
+    return escapedText;
+}
+
+//! \return la durée donnée (en nanosecondes) en microsecondes, l'unité des traces.
+QByteArray toMicroseconds(qint64 durationInNanoseconds) {
+    return QByteArray::number(durationInNanoseconds / 1000.0, 'f', 3);
+}
+
+//! Écrit un objet JSON dans le fichier de trace, précédé d'une virgule si nécessaire.
+void writeJsonObject(const QByteArray& rJsonObject) {
+    s_file.write(s_isFirstEvent ? "\n" : ",\n");
+    s_file.write(rJsonObject);
+    s_isFirstEvent = false;
+}
+
+//! Convertit en JSON et écrit les événements donnés.
+void writeEvents(const TraceEventBuffer& rEvents) {
+    for (const TraceEvent& rEvent : rEvents) {
+        writeJsonObject(QByteArray("{\"name\":\"") + jsonEscaped(rEvent.pName)
+                        + "\",\"cat\":\"game\",\"ph\":\"X\",\"ts\":" + toMicroseconds(rEvent.startTime)
+                        + ",\"dur\":" + toMicroseconds(rEvent.duration)
+                        + ",\"pid\":" + QByteArray::number(TRACE_PROCESS_ID)
+                        + ",\"tid\":" + QByteArray::number(rEvent.threadId) + "}");
+    }
+}
+
+//! Boucle du thread d'écriture : écrit les tampons transmis, jusqu'à ce que l'arrêt
+//! soit demandé et que tous les tampons aient été écrits.
+void writerLoop() {
+    for (;;) {
+        TraceEventBuffer events;
+        {
+            std::unique_lock<std::mutex> lock(s_queueMutex);
+            s_queueCondition.wait(lock, []() { return !s_pendingBuffers.isEmpty() || s_stopRequested; });
+            if (s_pendingBuffers.isEmpty())
+                return;
+            events = s_pendingBuffers.takeFirst();
+        }
+        writeEvents(events);
+    }
+}
+
+//! Transmet le tampon courant au thread d'écriture.
+//! Doit être appelé avec s_bufferMutex verrouillé.
+void submitBuffer() {
+    if (s_buffer.isEmpty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_queueMutex);
+        s_pendingBuffers.append(std::move(s_buffer));
+    }
+    s_queueCondition.notify_one();
+
+    s_buffer = TraceEventBuffer();
+    s_buffer.reserve(BUFFER_EVENT_COUNT);
+}
+
+} // namespace
+
+std::atomic<bool> TraceRecorder::s_recording(false);
+
+//! Démarre l'enregistrement de la trace dans le fichier donné, qui est écrasé s'il existe.
+//! Un éventuel enregistrement en cours est d'abord terminé.
+//! \param rFilePath  Chemin du fichier de trace.
+//! \return un booléen à faux si le fichier ne peut pas être créé.
+bool TraceRecorder::start(const QString& rFilePath) {
+    stop();
+
+    s_file.setFileName(rFilePath);
+    if (!s_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Impossible de créer la trace :" << rFilePath;
+        return false;
+    }
+
+    s_file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    s_isFirstEvent = true;
+    writeJsonObject(QByteArray("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":") + QByteArray::number(TRACE_PROCESS_ID)
+                    + ",\"args\":{\"name\":\"ZeldaFighter\"}}");
+    writeJsonObject(QByteArray("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":") + QByteArray::number(TRACE_PROCESS_ID)
+                    + ",\"tid\":" + QByteArray::number(currentThreadId()) + ",\"args\":{\"name\":\"Jeu\"}}");
+
+    s_buffer.clear();
+    s_buffer.reserve(BUFFER_EVENT_COUNT);
+    s_eventCount = 0;
+    s_stopRequested = false;
+    s_writerThread = std::thread(writerLoop);
+
+    // Une trace encore en cours à la fin du programme doit être terminée avant la
+    // destruction du thread d'écriture.
+    static const bool isStopRegistered = (std::atexit([]() { TraceRecorder::stop(); }) == 0);
+    Q_UNUSED(isStopRegistered);
+
+    s_recording.store(true, std::memory_order_relaxed);
+    qInfo() << "Enregistrement de la trace :" << rFilePath;
+    return true;
+}
+
+//! Termine l'enregistrement en cours : les derniers événements sont écrits et le fichier est fermé.
+void TraceRecorder::stop() {
+    if (!isRecording())
+        return;
+
+    s_recording.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(s_bufferMutex);
+        submitBuffer();
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_queueMutex);
+        s_stopRequested = true;
+    }
+    s_queueCondition.notify_one();
+    s_writerThread.join();
+
+    s_file.write("\n]}\n");
+    s_file.close();
+    qInfo() << "Trace terminée :" << s_eventCount << "événements écrits dans" << s_file.fileName();
+}
+
+//! \return le chemin du fichier de la trace en cours ou de la dernière trace.
+QString TraceRecorder::filePath() {
+    return s_file.fileName();
+}
+
+//! \return le temps courant, en nanosecondes, de l'horloge commune aux mesures (TickProfiler::now()).
+qint64 TraceRecorder::now() {
+    return TickProfiler::now();
+}
+
+//! Ajoute un intervalle mesuré à la trace, s'il y a un enregistrement en cours.
+//! \param pName      Nom de l'événement (chaîne constante, qui n'est pas copiée).
+//! \param startTime  Début de l'intervalle (en nanosecondes, selon now()).
+//! \param duration   Durée de l'intervalle (en nanosecondes).
+void TraceRecorder::addEvent(const char* pName, qint64 startTime, qint64 duration) {
+    const int threadId = currentThreadId();
+
+    std::lock_guard<std::mutex> lock(s_bufferMutex);
+    if (!isRecording())
+        return;
+
+    s_buffer.append(TraceEvent { pName, startTime, duration, threadId });
+    s_eventCount++;
+    if (s_buffer.size() >= BUFFER_EVENT_COUNT)
+        submitBuffer();
+}
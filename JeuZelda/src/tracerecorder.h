@@ -0,0 +1,82 @@
+/**
+  \file
+  \brief    Déclaration des classes TraceRecorder et TraceZone.
+  \date     octobre 2026
+*/
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+#include <atomic>
+
+#include <QString>
+#include <QtGlobal>
+
+//! \brief Enregistre la chronologie des ticks dans un fichier de trace JSON.
+//!
+//! Le fichier produit suit le format « Trace Event » de Chrome : il peut être ouvert
+//! avec chrome://tracing ou https://ui.perfetto.dev, qui affichent chaque intervalle
+//! mesuré sur une ligne de temps. On y voit ainsi quelles images ont dépassé la
+//! cadence prévue, et quelle partie du tick en est la cause.
+//!
+//! Chaque intervalle mesuré devient un événement complet (`"ph":"X"`) : les zones de
+//! mesure des phases du tick (ProfileZone, voir TickProfiler) et les zones nommées
+//! (TraceZone), par exemple une image complète, la réflexion de chaque type d'ennemi ou le
+//! dessin du HUD.
+//!
+//! Les événements sont d'abord ajoutés à un tampon en mémoire. Lorsque ce tampon est
+//! plein, il est transmis à un thread d'écriture qui les convertit en JSON et les écrit
+//! dans le fichier, afin que l'écriture ne ralentisse pas le jeu. stop() transmet les
+//! derniers événements, attend la fin de l'écriture et termine le fichier ; il est
+//! appelé automatiquement à la fin du programme si l'enregistrement est encore en cours.
+//!
+//! L'enregistrement est démarré par l'option `--trace` de la ligne de commande, ou en
+//! cours de jeu par les touches Ctrl+Shift+T (voir \ref canvas_profiling).
+//!
+//! Les noms des événements ne sont pas copiés : ce doivent être des chaînes constantes.
+class TraceRecorder
+{
+public:
+    static bool start(const QString& rFilePath);
+    static void stop();
+    static bool isRecording() { return s_recording.load(std::memory_order_relaxed); }
+    static QString filePath();
+
+    static qint64 now();
+    static void addEvent(const char* pName, qint64 startTime, qint64 duration);
+
+private:
+    TraceRecorder() = delete;
+
+    static std::atomic<bool> s_recording;
+};
+
+//! \brief Zone nommée : l'intervalle entre sa construction et sa destruction est ajouté
+//! à la trace (TraceRecorder) sous le nom donné, si un enregistrement est en cours.
+//!
+//!     {
+//!         TraceZone zone("HUD");
+//!         ...
+//!     }
+//!
+//! Contrairement à ProfileZone, la durée n'est pas comptée dans les statistiques
+//! des phases du tick.
+class TraceZone
+{
+public:
+    explicit TraceZone(const char* pName)
+        : m_pName(pName), m_startTime(TraceRecorder::isRecording() ? TraceRecorder::now() : -1) {}
+
+    ~TraceZone() {
+        if (m_startTime >= 0)
+            TraceRecorder::addEvent(m_pName, m_startTime, TraceRecorder::now() - m_startTime);
+    }
+
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+    const char* m_pName;
+    qint64 m_startTime;
+};
+
+#endif // TRACERECORDER_H
@@ -0,0 +1,89 @@
+/**
+  \file
+  \brief    Définition de la classe WorkerPool.
+  \date     octobre 2026
+*/
+#include "workerpool.h"
+
+#include <atomic>
+#include <memory>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+
+QThreadPool* WorkerPool::s_pThreadPool = nullptr;
+int WorkerPool::s_threadCount = 0;
+
+namespace {
+
+//! Tranches d'un appel à run(), partagées par les threads qui les traitent.
+struct SharedTasks {
+    std::atomic<int> nextTaskIndex { 0 };
+    QSemaphore finishedHelpers;
+};
+
+//! Traite les tranches restantes, une à une, jusqu'à ce qu'il n'en reste plus.
+void processTasks(SharedTasks& rShared, int taskCount, const std::function<void(int)>& rTask) {
+    for (;;) {
+        const int taskIndex = rShared.nextTaskIndex.fetch_add(1, std::memory_order_relaxed);
+        if (taskIndex >= taskCount)
+            return;
+        rTask(taskIndex);
+    }
+}
+
+} // namespace
+
+//! Fait traiter les tranches 0 à taskCount - 1 par les threads de calcul et le thread
+//! appelant, puis attend qu'elles soient toutes traitées.
+//! \param taskCount  Nombre de tranches.
+//! \param rTask      Traitement d'une tranche, appelé avec son numéro.
+void WorkerPool::run(int taskCount, const std::function<void(int taskIndex)>& rTask) {
+    const int helperCount = qMin(threadCount(), taskCount) - 1;
+    if (helperCount <= 0) {
+        for (int taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            rTask(taskIndex);
+        return;
+    }
+
+    const std::shared_ptr<SharedTasks> pShared = std::make_shared<SharedTasks>();
+    for (int helper = 0; helper < helperCount; ++helper) {
+        threadPool()->start([pShared, taskCount, &rTask]() {
+            processTasks(*pShared, taskCount, rTask);
+            pShared->finishedHelpers.release();
+        });
+    }
+    processTasks(*pShared, taskCount, rTask);
+    // Les autres threads peuvent encore traiter leur dernière tranche.
+    pShared->finishedHelpers.acquire(helperCount);
+}
+
+//! \return le nombre de threads (thread appelant compris) qui traitent les tranches.
+//! Par défaut, le nombre de cœurs du processeur.
+int WorkerPool::threadCount() {
+    if (s_threadCount <= 0)
+        s_threadCount = qMax(1, QThread::idealThreadCount());
+    return s_threadCount;
+}
+
+//! Change le nombre de threads qui traitent les tranches (1 : le thread appelant seul).
+void WorkerPool::setThreadCount(int threadCount) {
+    s_threadCount = qMax(1, threadCount);
+    if (s_pThreadPool != nullptr)
+        s_pThreadPool->setMaxThreadCount(qMax(1, s_threadCount - 1));
+}
+
+//! Arrête les threads de calcul.
+void WorkerPool::clear() {
+    delete s_pThreadPool;
+    s_pThreadPool = nullptr;
+}
+
+//! \return le QThreadPool des threads de calcul, créé au premier appel.
+QThreadPool* WorkerPool::threadPool() {
+    if (s_pThreadPool == nullptr) {
+        s_pThreadPool = new QThreadPool;
+        s_pThreadPool->setMaxThreadCount(qMax(1, threadCount() - 1));
+    }
+    return s_pThreadPool;
+}
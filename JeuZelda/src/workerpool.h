@@ -0,0 +1,46 @@
+/**
+  \file
+  \brief    Déclaration de la classe WorkerPool.
+  \date     octobre 2026
+*/
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <functional>
+
+class QThreadPool;
+
+//! \brief Threads de calcul du jeu, qui se partagent les tranches d'un même travail.
+//!
+//! run() découpe un travail en tranches numérotées et les fait traiter par les threads
+//! de son QThreadPool, qui n'est pas celui d'AssetPreloader : le décodage des images ne
+//! retarde donc pas le tick. Le thread appelant participe lui aussi. Chaque thread prend
+//! la tranche suivante dès qu'il a fini la sienne, à l'aide d'un compteur atomique
+//! partagé : un thread ralenti laisse ses tranches aux autres, sans répartition fixée
+//! d'avance. run() ne retourne qu'une fois toutes les tranches traitées.
+//!
+//! L'ordre dans lequel les tranches sont traitées n'est pas défini : chaque tranche doit
+//! écrire ses résultats à sa propre place (voir EnemyStore::update()).
+//!
+//! Avec setThreadCount(1), les tranches sont traitées dans l'ordre par le thread
+//! appelant. clear() doit être appelé avant la destruction de QApplication.
+class WorkerPool
+{
+public:
+    static void run(int taskCount, const std::function<void(int taskIndex)>& rTask);
+
+    static int threadCount();
+    static void setThreadCount(int threadCount);
+
+    static void clear();
+
+private:
+    WorkerPool() = delete;
+
+    static QThreadPool* threadPool();
+
+    static QThreadPool* s_pThreadPool;
+    static int s_threadCount;
+};
+
+#endif // WORKERPOOL_H